@@ -41,6 +41,7 @@ function(thrust_configure_multiconfig)
     option(THRUST_MULTICONFIG_ENABLE_SYSTEM_CUDA "Generate build configurations that use CUDA." ON)
     option(THRUST_MULTICONFIG_ENABLE_SYSTEM_OMP "Generate build configurations that use OpenMP." OFF)
     option(THRUST_MULTICONFIG_ENABLE_SYSTEM_TBB "Generate build configurations that use TBB." OFF)
+    option(THRUST_MULTICONFIG_ENABLE_SYSTEM_THREADS "Generate build configurations that use std::thread." OFF)
 
     # CMake fixed C++17 support for NVCC + MSVC targets in 3.18.3:
     if (THRUST_MULTICONFIG_ENABLE_DIALECT_CPP17 AND
@@ -49,49 +50,58 @@ function(thrust_configure_multiconfig)
     endif()
 
     # Workload:
-    # - `SMALL`: [3 configs] Minimal coverage and validation of each device system against the `CPP` host.
-    # - `MEDIUM`: [6 configs] Cheap extended coverage.
-    # - `LARGE`: [8 configs] Expensive extended coverage. Include all useful build configurations.
-    # - `FULL`: [12 configs] The complete cross product of all possible build configurations.
+    # - `SMALL`: [4 configs] Minimal coverage and validation of each device system against the `CPP` host.
+    # - `MEDIUM`: [8 configs] Cheap extended coverage.
+    # - `LARGE`: [11 configs] Expensive extended coverage. Include all useful build configurations.
+    # - `FULL`: [20 configs] The complete cross product of all possible build configurations.
     #
-    # Config   | Workloads | Value      | Expense   | Note
-    # ---------|-----------|------------|-----------|-----------------------------
-    # CPP/CUDA | F L M S   | Essential  | Expensive | Validates CUDA against CPP
-    # CPP/OMP  | F L M S   | Essential  | Cheap     | Validates OMP against CPP
-    # CPP/TBB  | F L M S   | Essential  | Cheap     | Validates TBB against CPP
-    # CPP/CPP  | F L M     | Important  | Cheap     | Tests CPP as device
-    # OMP/OMP  | F L M     | Important  | Cheap     | Tests OMP as host
-    # TBB/TBB  | F L M     | Important  | Cheap     | Tests TBB as host
-    # TBB/CUDA | F L       | Important  | Expensive | Validates TBB/CUDA interop
-    # OMP/CUDA | F L       | Important  | Expensive | Validates OMP/CUDA interop
-    # TBB/OMP  | F         | Not useful | Cheap     | Mixes CPU-parallel systems
-    # OMP/TBB  | F         | Not useful | Cheap     | Mixes CPU-parallel systems
-    # TBB/CPP  | F         | Not Useful | Cheap     | Parallel host, serial device
-    # OMP/CPP  | F         | Not Useful | Cheap     | Parallel host, serial device
+    # Config          | Workloads | Value      | Expense   | Note
+    # ----------------|-----------|------------|-----------|-----------------------------
+    # CPP/CUDA        | F L M S   | Essential  | Expensive | Validates CUDA against CPP
+    # CPP/OMP         | F L M S   | Essential  | Cheap     | Validates OMP against CPP
+    # CPP/TBB         | F L M S   | Essential  | Cheap     | Validates TBB against CPP
+    # CPP/THREADS     | F L M S   | Essential  | Cheap     | Validates THREADS against CPP
+    # CPP/CPP         | F L M     | Important  | Cheap     | Tests CPP as device
+    # OMP/OMP         | F L M     | Important  | Cheap     | Tests OMP as host
+    # TBB/TBB         | F L M     | Important  | Cheap     | Tests TBB as host
+    # THREADS/THREADS | F L M     | Important  | Cheap     | Tests THREADS as host
+    # TBB/CUDA        | F L       | Important  | Expensive | Validates TBB/CUDA interop
+    # OMP/CUDA        | F L       | Important  | Expensive | Validates OMP/CUDA interop
+    # THREADS/CUDA    | F L       | Important  | Expensive | Validates THREADS/CUDA interop
+    # TBB/OMP         | F         | Not useful | Cheap     | Mixes CPU-parallel systems
+    # OMP/TBB         | F         | Not useful | Cheap     | Mixes CPU-parallel systems
+    # THREADS/OMP     | F         | Not useful | Cheap     | Mixes CPU-parallel systems
+    # OMP/THREADS     | F         | Not useful | Cheap     | Mixes CPU-parallel systems
+    # THREADS/TBB     | F         | Not useful | Cheap     | Mixes CPU-parallel systems
+    # TBB/THREADS     | F         | Not useful | Cheap     | Mixes CPU-parallel systems
+    # TBB/CPP         | F         | Not Useful | Cheap     | Parallel host, serial device
+    # OMP/CPP         | F         | Not Useful | Cheap     | Parallel host, serial device
+    # THREADS/CPP     | F         | Not Useful | Cheap     | Parallel host, serial device
 
     set(THRUST_MULTICONFIG_WORKLOAD SMALL CACHE STRING
-      "Limit host/device configs: SMALL (up to 3 h/d combos per dialect), MEDIUM(6), LARGE(8), FULL(12)"
+      "Limit host/device configs: SMALL (up to 4 h/d combos per dialect), MEDIUM(8), LARGE(11), FULL(20)"
     )
     set_property(CACHE THRUST_MULTICONFIG_WORKLOAD PROPERTY STRINGS
       SMALL MEDIUM LARGE FULL
     )
     set(THRUST_MULTICONFIG_WORKLOAD_SMALL_CONFIGS
-      CPP_OMP CPP_TBB CPP_CUDA
+      CPP_OMP CPP_TBB CPP_THREADS CPP_CUDA
       CACHE INTERNAL "Host/device combos enabled for SMALL workloads." FORCE
     )
     set(THRUST_MULTICONFIG_WORKLOAD_MEDIUM_CONFIGS
       ${THRUST_MULTICONFIG_WORKLOAD_SMALL_CONFIGS}
-      CPP_CPP TBB_TBB OMP_OMP
+      CPP_CPP TBB_TBB OMP_OMP THREADS_THREADS
       CACHE INTERNAL "Host/device combos enabled for MEDIUM workloads." FORCE
     )
     set(THRUST_MULTICONFIG_WORKLOAD_LARGE_CONFIGS
       ${THRUST_MULTICONFIG_WORKLOAD_MEDIUM_CONFIGS}
-      OMP_CUDA TBB_CUDA
+      OMP_CUDA TBB_CUDA THREADS_CUDA
       CACHE INTERNAL "Host/device combos enabled for LARGE workloads." FORCE
     )
     set(THRUST_MULTICONFIG_WORKLOAD_FULL_CONFIGS
       ${THRUST_MULTICONFIG_WORKLOAD_LARGE_CONFIGS}
-      OMP_CPP TBB_CPP OMP_TBB TBB_OMP
+      OMP_CPP TBB_CPP THREADS_CPP OMP_TBB TBB_OMP
+      OMP_THREADS THREADS_OMP TBB_THREADS THREADS_TBB
       CACHE INTERNAL "Host/device combos enabled for FULL workloads." FORCE
     )
 
@@ -4,6 +4,7 @@
 #include <thrust/system/cpp/detail/par.h>
 #include <thrust/system/omp/detail/par.h>
 #include <thrust/system/tbb/detail/par.h>
+#include <thrust/system/threads/detail/par.h>
 
 #if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 #include <thrust/system/cuda/detail/par.h>
@@ -128,12 +129,16 @@ typedef policy_info<
 > cpp_par_info;
 typedef policy_info<
     thrust::system::omp::detail::par_t,
-    thrust::system::omp::detail::execution_policy
+    thrust::system::omp::detail::execute_with_options_base
 > omp_par_info;
 typedef policy_info<
     thrust::system::tbb::detail::par_t,
-    thrust::system::tbb::detail::execution_policy
+    thrust::system::tbb::detail::execute_on_arena_base
 > tbb_par_info;
+typedef policy_info<
+    thrust::system::threads::detail::par_t,
+    thrust::system::threads::detail::execute_with_options_base
+> threads_par_info;
 
 #if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 typedef policy_info<
@@ -151,6 +156,7 @@ SimpleUnitTest<
 #endif
         cpp_par_info,
         omp_par_info,
-        tbb_par_info
+        tbb_par_info,
+        threads_par_info
     >
 > TestAllocatorAttachmentInstance;
@@ -5,6 +5,9 @@
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+#include <vector>
+
 THRUST_DISABLE_MSVC_POSSIBLE_LOSS_OF_DATA_WARNING_BEGIN
 
 //////////////////////
@@ -290,6 +293,61 @@ void TestScalarEqualRangeDispatchImplicit()
 }
 DECLARE_UNITTEST(TestScalarEqualRangeDispatchImplicit);
 
+
+// counts the temporary allocations of the algorithms it's attached to
+struct counting_allocator
+{
+    typedef char value_type;
+
+    size_t *num_allocations;
+
+    char *allocate(std::ptrdiff_t n)
+    {
+        ++*num_allocations;
+        return static_cast<char *>(::operator new(n));
+    }
+
+    void deallocate(char *p, size_t)
+    {
+        ::operator delete(p);
+    }
+};
+
+template <typename Policy, typename Vector>
+void TestScalarSearchesDontAllocate(Policy policy, const Vector &vec, size_t &num_allocations)
+{
+    const std::vector<int> ref(vec.begin(), vec.end());
+
+    for (int value = -1; value <= ref.back() + 1; ++value)
+    {
+        ASSERT_EQUAL(thrust::lower_bound(policy, vec.begin(), vec.end(), value) - vec.begin(), std::lower_bound(ref.begin(), ref.end(), value) - ref.begin());
+        ASSERT_EQUAL(thrust::upper_bound(policy, vec.begin(), vec.end(), value) - vec.begin(), std::upper_bound(ref.begin(), ref.end(), value) - ref.begin());
+        ASSERT_EQUAL(thrust::binary_search(policy, vec.begin(), vec.end(), value), std::binary_search(ref.begin(), ref.end(), value));
+        ASSERT_EQUAL(thrust::equal_range(policy, vec.begin(), vec.end(), value).second - vec.begin(), std::upper_bound(ref.begin(), ref.end(), value) - ref.begin());
+    }
+
+    ASSERT_EQUAL(num_allocations, 0u);
+}
+
+void TestScalarSearchesDontAllocateOnHostSystems()
+{
+    size_t num_allocations = 0;
+    counting_allocator alloc = {&num_allocations};
+
+    // the even numbers below 2 * 37
+    thrust::host_vector<int> h_vec(37);
+    thrust::sequence(h_vec.begin(), h_vec.end(), 0, 2);
+
+    TestScalarSearchesDontAllocate(thrust::host(alloc), h_vec, num_allocations);
+
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+    thrust::device_vector<int> d_vec = h_vec;
+
+    TestScalarSearchesDontAllocate(thrust::device(alloc), d_vec, num_allocations);
+#endif
+}
+DECLARE_UNITTEST(TestScalarSearchesDontAllocateOnHostSystems);
+
 THRUST_DISABLE_MSVC_POSSIBLE_LOSS_OF_DATA_WARNING_END
 
 void TestBoundsWithBigIndexesHelper(int magnitude)
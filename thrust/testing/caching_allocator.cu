@@ -2,6 +2,11 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/detail/caching_allocator.h>
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/mr/host_tls_pool.h>
+#include <thrust/reduce.h>
+#include <thrust/unique.h>
 
 template<typename Allocator>
 void test_implementation(Allocator alloc)
@@ -21,3 +26,50 @@ void TestSingleDeviceTLSCachingAllocator()
     test_implementation(thrust::detail::single_device_tls_caching_allocator());
 };
 DECLARE_UNITTEST(TestSingleDeviceTLSCachingAllocator);
+
+void TestHostTLSCachingAllocator()
+{
+    test_implementation(thrust::mr::host_tls_caching_allocator());
+};
+DECLARE_UNITTEST(TestHostTLSCachingAllocator);
+
+template<typename ExecutionPolicy>
+void test_temporary_storage(ExecutionPolicy policy)
+{
+    thrust::host_vector<int> keys(1000);
+    thrust::host_vector<int> values(1000, 1);
+
+    for(int i = 0; i < 1000; ++i)
+    {
+        keys[i] = i / 10;
+    }
+
+    thrust::host_vector<int> keys_result(1000);
+    thrust::host_vector<int> values_result(1000);
+
+    // repeat, so that later calls are served by the pool
+    for(int i = 0; i < 3; ++i)
+    {
+        thrust::pair<thrust::host_vector<int>::iterator, thrust::host_vector<int>::iterator> ends =
+            thrust::reduce_by_key(policy,
+                                  keys.begin(), keys.end(),
+                                  values.begin(),
+                                  keys_result.begin(),
+                                  values_result.begin());
+
+        ASSERT_EQUAL(ends.first - keys_result.begin(), 100);
+        ASSERT_EQUAL(values_result[0], 10);
+        ASSERT_EQUAL(values_result[99], 10);
+
+        thrust::host_vector<int> unique_keys = keys;
+
+        ASSERT_EQUAL(thrust::unique(policy, unique_keys.begin(), unique_keys.end()) - unique_keys.begin(), 100);
+        ASSERT_EQUAL(unique_keys[99], 99);
+    }
+}
+
+void TestHostTLSCachingAllocatorTemporaryStorage()
+{
+    test_temporary_storage(thrust::host(thrust::mr::host_tls_caching_allocator()));
+}
+DECLARE_UNITTEST(TestHostTLSCachingAllocatorTemporaryStorage);
@@ -305,6 +305,26 @@ struct TestFindIfNot
 };
 VariableUnitTest<TestFindIfNot, SignedIntegralTypes> TestFindIfNotInstance;
 
+
+template <typename T>
+struct TestFindIfFirstOfManyMatches
+{
+    void operator()(const size_t n)
+    {
+        // every element from the first match on matches as well
+        thrust::device_vector<T> d_data(n);
+        thrust::sequence(d_data.begin(), d_data.end(), T(n), T(-1));
+
+        for (size_t i = 1; i < n; i *= 2)
+        {
+            typename thrust::device_vector<T>::iterator d_iter =
+              thrust::find_if(d_data.begin(), d_data.end(), less_than_value_pred<T>(T(n - i + 1)));
+            ASSERT_EQUAL(static_cast<size_t>(d_iter - d_data.begin()), i);
+        }
+    }
+};
+VariableUnitTest<TestFindIfFirstOfManyMatches, LargeIntegralTypes> TestFindIfFirstOfManyMatchesInstance;
+
 void TestFindWithBigIndexesHelper(int magnitude)
 {
     thrust::counting_iterator<long long> begin(1);
@@ -7,6 +7,8 @@
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/retag.h>
 
+#include <algorithm>
+
 template<typename Vector>
 void TestMergeSimple(void)
 {
@@ -101,7 +103,8 @@ DECLARE_UNITTEST(TestMergeDispatchImplicit);
 template<typename T>
   void TestMerge(size_t n)
 {
-  size_t sizes[]   = {0, 1, n / 2, n, n + 1, 2 * n};
+  // the host systems gallop over the longer of uneven inputs
+  size_t sizes[]   = {0, 1, n / 64, n / 8, n / 2, n, n + 1, 2 * n};
   size_t num_sizes = sizeof(sizes) / sizeof(size_t);
 
   thrust::host_vector<T> random = unittest::random_integers<unittest::int8_t>(n + *thrust::max_element(sizes, sizes + num_sizes));
@@ -136,6 +139,36 @@ template<typename T>
     d_result.resize(d_end - d_result.begin());
 
     ASSERT_EQUAL(h_result, d_result);
+
+    thrust::host_vector<T> reference(n + size);
+
+    reference.resize(std::merge(h_a.begin(), h_a.end(),
+                                h_b.begin(), h_b.begin() + size,
+                                reference.begin()) - reference.begin());
+
+    ASSERT_EQUAL(reference, h_result);
+
+    // and with the shorter input first
+    reference.resize(n + size);
+    h_result.resize(n + size);
+    d_result.resize(n + size);
+
+    reference.resize(std::merge(h_b.begin(), h_b.begin() + size,
+                                h_a.begin(), h_a.end(),
+                                reference.begin()) - reference.begin());
+
+    h_end = thrust::merge(h_b.begin(), h_b.begin() + size,
+                          h_a.begin(), h_a.end(),
+                          h_result.begin());
+    h_result.resize(h_end - h_result.begin());
+
+    d_end = thrust::merge(d_b.begin(), d_b.begin() + size,
+                          d_a.begin(), d_a.end(),
+                          d_result.begin());
+    d_result.resize(d_end - d_result.begin());
+
+    ASSERT_EQUAL(reference, h_result);
+    ASSERT_EQUAL(reference, d_result);
   }
 }
 DECLARE_VARIABLE_UNITTEST(TestMerge);
@@ -0,0 +1,189 @@
+#include <thrust/detail/config.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#include <unittest/unittest.h>
+
+#include <thrust/async/for_each.h>
+#include <thrust/async/reduce.h>
+#include <thrust/async/sort.h>
+#include <thrust/async/transform.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/system/omp/future.h>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+struct record_thread
+{
+  std::thread::id *id;
+
+  record_thread(std::thread::id *id) : id(id) {}
+
+  void operator()(int) const
+  {
+    *id = std::this_thread::get_id();
+  }
+};
+
+
+struct record_team_size
+{
+  int *team_size;
+
+  record_team_size(int *team_size) : team_size(team_size) {}
+
+  void operator()(int) const
+  {
+    const int n = omp_get_num_threads();
+
+    THRUST_PRAGMA_OMP(critical)
+    {
+      if(n > *team_size)
+      {
+        *team_size = n;
+      }
+    }
+  }
+};
+
+
+struct negate_or_throw
+{
+  int operator()(int x) const
+  {
+    if(x < 0)
+    {
+      throw std::runtime_error("negative input");
+    }
+
+    return -x;
+  }
+};
+
+
+template<typename T>
+struct TestOmpAsyncReduce
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+    thrust::omp::future<T> f0 = thrust::async::reduce(thrust::omp::par, h_input.begin(), h_input.end());
+
+    ASSERT_EQUAL(f0.get(), thrust::reduce(h_input.begin(), h_input.end()));
+  }
+};
+VariableUnitTest<TestOmpAsyncReduce, IntegralTypes> TestOmpAsyncReduceInstance;
+
+
+void TestOmpAsyncRunsOffTheCallingThread(void)
+{
+  thrust::host_vector<int> h_input(1);
+
+  std::thread::id id = std::this_thread::get_id();
+
+  thrust::omp::event e0 = thrust::async::for_each(thrust::omp::par, h_input.begin(), h_input.end(), record_thread(&id));
+  e0.wait();
+
+  ASSERT_EQUAL(id != std::this_thread::get_id(), true);
+}
+DECLARE_UNITTEST(TestOmpAsyncRunsOffTheCallingThread);
+
+
+void TestOmpAsyncSharesThreadsBetweenTeams(void)
+{
+  thrust::host_vector<int> h_input(10000, 1);
+
+  // each thread of the pool gets its share of the calling thread's threads
+  const int pool_size     = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  const int max_team_size = std::max(1, omp_get_max_threads() / pool_size);
+
+  int team_size = 0;
+  thrust::async::for_each(thrust::omp::par, h_input.begin(), h_input.end(), record_team_size(&team_size)).wait();
+
+  ASSERT_EQUAL(true, team_size >= 1 && team_size <= max_team_size);
+
+  // unless the policy asks for a number of threads itself
+  team_size = 0;
+  thrust::async::for_each(thrust::omp::par.on(2), h_input.begin(), h_input.end(), record_team_size(&team_size)).wait();
+
+  ASSERT_EQUAL(true, team_size >= 1 && team_size <= 2);
+}
+DECLARE_UNITTEST(TestOmpAsyncSharesThreadsBetweenTeams);
+
+
+template<typename T>
+struct TestOmpAsyncAfter
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+    thrust::host_vector<T> h_result(n);
+
+    auto e0 = thrust::async::transform(thrust::omp::par, h_input.begin(), h_input.end(), h_result.begin(), thrust::negate<T>());
+    auto e1 = thrust::async::stable_sort(thrust::omp::par.after(e0), h_result.begin(), h_result.end(), thrust::less<T>());
+    auto f2 = thrust::async::reduce(thrust::omp::par.after(e1), h_result.begin(), h_result.end());
+
+    // the dependencies were consumed by the policies
+    ASSERT_EQUAL(e0.valid(), false);
+    ASSERT_EQUAL(e1.valid(), false);
+
+    const T sum = f2.get();
+
+    thrust::host_vector<T> h_reference(n);
+    thrust::transform(h_input.begin(), h_input.end(), h_reference.begin(), thrust::negate<T>());
+    thrust::stable_sort(h_reference.begin(), h_reference.end());
+
+    ASSERT_EQUAL(h_result, h_reference);
+    ASSERT_EQUAL(sum, thrust::reduce(h_reference.begin(), h_reference.end()));
+  }
+};
+VariableUnitTest<TestOmpAsyncAfter, IntegralTypes> TestOmpAsyncAfterInstance;
+
+
+void TestOmpAsyncWhenAll(void)
+{
+  thrust::host_vector<int> h_input0 = unittest::random_integers<int>(10000);
+  thrust::host_vector<int> h_input1 = unittest::random_integers<int>(10000);
+
+  auto e0 = thrust::async::sort(thrust::omp::par, h_input0.begin(), h_input0.end());
+  auto f1 = thrust::async::reduce(thrust::omp::par, h_input1.begin(), h_input1.end());
+
+  thrust::omp::event e2 = thrust::when_all(e0, f1);
+
+  ASSERT_EQUAL(e0.valid(), false);
+  ASSERT_EQUAL(f1.valid(), false);
+
+  e2.wait();
+
+  ASSERT_EQUAL(e2.ready(), true);
+  ASSERT_EQUAL(thrust::is_sorted(h_input0.begin(), h_input0.end()), true);
+}
+DECLARE_UNITTEST(TestOmpAsyncWhenAll);
+
+
+void TestOmpAsyncPropagatesExceptions(void)
+{
+  thrust::host_vector<int> h_input(10, 1);
+  thrust::host_vector<int> h_result(10);
+  h_input[5] = -1;
+
+  // exceptions can't leave a parallel region, so raise the cutoff above the
+  // input's size to transform sequentially
+  auto e0 = thrust::async::transform(thrust::omp::par.min_parallel_size(h_input.size() + 1), h_input.begin(), h_input.end(), h_result.begin(), negate_or_throw());
+  auto f1 = thrust::async::reduce(thrust::omp::par.after(e0), h_result.begin(), h_result.end());
+
+  // the reduction depends on the failed transform, so it fails too
+  ASSERT_THROWS(f1.get(), std::runtime_error);
+}
+DECLARE_UNITTEST(TestOmpAsyncPropagatesExceptions);
+
+#endif
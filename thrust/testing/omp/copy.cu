@@ -0,0 +1,61 @@
+#include <unittest/unittest.h>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/equal.h>
+#include <thrust/fill.h>
+#include <thrust/sequence.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <cstddef>
+
+template<typename T>
+struct TestOmpCopyAndFillStreaming
+{
+  void operator()(void)
+  {
+    // larger than the last level cache, so the stores stream around it
+    const size_t n = (40 << 20) / sizeof(T) + 3;
+
+    thrust::host_vector<T> h_input(n);
+    thrust::sequence(h_input.begin(), h_input.end());
+
+    // misaligned ranges exercise the edges of the blocks
+    for(size_t offset = 0; offset < 3; ++offset)
+    {
+      thrust::host_vector<T> h_result(n, T(0));
+
+      thrust::copy(thrust::omp::par, h_input.begin() + offset, h_input.end() - 1, h_result.begin() + 1);
+
+      ASSERT_EQUAL(h_result[0], T(0));
+      ASSERT_EQUAL(thrust::equal(h_input.begin() + offset, h_input.end() - 1, h_result.begin() + 1), true);
+
+      const T last = h_result[n - 1];
+
+      thrust::fill(thrust::omp::par, h_result.begin() + offset, h_result.end() - 1, T(13));
+
+      ASSERT_EQUAL(thrust::count(h_result.begin() + offset, h_result.end() - 1, T(13)),
+                   static_cast<std::ptrdiff_t>(n - offset - 1));
+      ASSERT_EQUAL(h_result[n - 1], last);
+    }
+  }
+};
+SimpleUnitTest<TestOmpCopyAndFillStreaming, unittest::type_list<char, short, int, long long> > TestOmpCopyAndFillStreamingInstance;
+
+
+void TestOmpCopyOverlapping(void)
+{
+  const size_t n = 1 << 20;
+
+  thrust::host_vector<int> h_data(n);
+  thrust::sequence(h_data.begin(), h_data.end());
+
+  // shifting a range left onto itself still copies it in order
+  thrust::copy(thrust::omp::par, h_data.begin() + 7, h_data.end(), h_data.begin());
+
+  thrust::host_vector<int> h_reference(n);
+  thrust::sequence(h_reference.begin(), h_reference.end(), 7);
+
+  ASSERT_EQUAL(thrust::equal(h_data.begin(), h_data.end() - 7, h_reference.begin()), true);
+}
+DECLARE_UNITTEST(TestOmpCopyOverlapping);
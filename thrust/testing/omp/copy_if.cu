@@ -0,0 +1,124 @@
+#include <unittest/unittest.h>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/partition.h>
+#include <thrust/remove.h>
+#include <thrust/system/omp/execution_policy.h>
+
+template<typename T>
+struct is_even
+{
+  bool operator()(T x) const
+  {
+    return (x & 1) == 0;
+  }
+};
+
+
+template<typename T>
+void TestOmpCopyIf(const size_t n)
+{
+  thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T> h_output(n);
+  thrust::host_vector<T> h_reference(n);
+
+  typename thrust::host_vector<T>::iterator h_end =
+    thrust::copy_if(thrust::omp::par, h_input.begin(), h_input.end(), h_output.begin(), is_even<T>());
+  typename thrust::host_vector<T>::iterator h_reference_end =
+    thrust::copy_if(h_input.begin(), h_input.end(), h_reference.begin(), is_even<T>());
+
+  ASSERT_EQUAL(h_end - h_output.begin(), h_reference_end - h_reference.begin());
+  h_output.resize(h_end - h_output.begin());
+  h_reference.resize(h_reference_end - h_reference.begin());
+  ASSERT_EQUAL(h_output, h_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpCopyIf);
+
+
+template<typename T>
+void TestOmpCopyIfStencil(const size_t n)
+{
+  thrust::host_vector<T>   h_input = unittest::random_integers<T>(n);
+  thrust::host_vector<int> h_stencil = unittest::random_integers<int>(n);
+
+  thrust::host_vector<T> h_output(n);
+  thrust::host_vector<T> h_reference(n);
+
+  typename thrust::host_vector<T>::iterator h_end =
+    thrust::copy_if(thrust::omp::par, h_input.begin(), h_input.end(), h_stencil.begin(), h_output.begin(), is_even<int>());
+  typename thrust::host_vector<T>::iterator h_reference_end =
+    thrust::copy_if(h_input.begin(), h_input.end(), h_stencil.begin(), h_reference.begin(), is_even<int>());
+
+  ASSERT_EQUAL(h_end - h_output.begin(), h_reference_end - h_reference.begin());
+  h_output.resize(h_end - h_output.begin());
+  h_reference.resize(h_reference_end - h_reference.begin());
+  ASSERT_EQUAL(h_output, h_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpCopyIfStencil);
+
+
+template<typename T>
+void TestOmpCopyIfAllOrNone(const size_t n)
+{
+  // every tile keeps all of its elements, or none of them
+  thrust::host_vector<T> h_input(n, T(2));
+  thrust::host_vector<T> h_output(n, T(1));
+
+  typename thrust::host_vector<T>::iterator h_end =
+    thrust::copy_if(thrust::omp::par, h_input.begin(), h_input.end(), h_output.begin(), is_even<T>());
+
+  ASSERT_EQUAL_QUIET(h_end, h_output.end());
+  ASSERT_EQUAL(h_output, h_input);
+
+  thrust::fill(h_input.begin(), h_input.end(), T(3));
+
+  h_end = thrust::copy_if(thrust::omp::par, h_input.begin(), h_input.end(), h_output.begin(), is_even<T>());
+
+  ASSERT_EQUAL_QUIET(h_end, h_output.begin());
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpCopyIfAllOrNone);
+
+
+template<typename T>
+void TestOmpRemoveCopyIf(const size_t n)
+{
+  thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T> h_output(n);
+  thrust::host_vector<T> h_reference(n);
+
+  typename thrust::host_vector<T>::iterator h_end =
+    thrust::remove_copy_if(thrust::omp::par, h_input.begin(), h_input.end(), h_output.begin(), is_even<T>());
+  typename thrust::host_vector<T>::iterator h_reference_end =
+    thrust::remove_copy_if(h_input.begin(), h_input.end(), h_reference.begin(), is_even<T>());
+
+  ASSERT_EQUAL(h_end - h_output.begin(), h_reference_end - h_reference.begin());
+  h_output.resize(h_end - h_output.begin());
+  h_reference.resize(h_reference_end - h_reference.begin());
+  ASSERT_EQUAL(h_output, h_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpRemoveCopyIf);
+
+
+template<typename T>
+void TestOmpStablePartitionCopy(const size_t n)
+{
+  thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+  // both outputs are written in a single sweep
+  thrust::host_vector<T> h_true(n), h_false(n);
+  thrust::host_vector<T> h_true_reference(n), h_false_reference(n);
+
+  thrust::pair<typename thrust::host_vector<T>::iterator, typename thrust::host_vector<T>::iterator> h_ends =
+    thrust::stable_partition_copy(thrust::omp::par, h_input.begin(), h_input.end(), h_true.begin(), h_false.begin(), is_even<T>());
+  thrust::pair<typename thrust::host_vector<T>::iterator, typename thrust::host_vector<T>::iterator> h_reference_ends =
+    thrust::stable_partition_copy(h_input.begin(), h_input.end(), h_true_reference.begin(), h_false_reference.begin(), is_even<T>());
+
+  ASSERT_EQUAL(h_ends.first - h_true.begin(), h_reference_ends.first - h_true_reference.begin());
+  ASSERT_EQUAL(h_ends.second - h_false.begin(), h_reference_ends.second - h_false_reference.begin());
+  ASSERT_EQUAL(h_true, h_true_reference);
+  ASSERT_EQUAL(h_false, h_false_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpStablePartitionCopy);
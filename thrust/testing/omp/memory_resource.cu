@@ -0,0 +1,149 @@
+#include <unittest/unittest.h>
+
+#include <thrust/count.h>
+#include <thrust/system/omp/memory.h>
+#include <thrust/system/omp/memory_resource.h>
+#include <thrust/system/omp/vector.h>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+template<typename Resource>
+void TestOmpMemoryResourceAllocates(void)
+{
+  Resource resource;
+
+  // both sides of the cutoff for mapping fresh pages
+  const std::size_t sizes[] = { 1, 4096, (1 << 20) - 1, 1 << 20, (16 << 20) + 5 };
+
+  for(std::size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); ++i)
+  {
+    thrust::omp::pointer<void> p = resource.allocate(sizes[i], 64);
+
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(p.get()) % 64, 0u);
+
+    // the whole block is writable
+    char *bytes = static_cast<char *>(p.get());
+    bytes[0] = 1;
+    bytes[sizes[i] - 1] = 1;
+
+    resource.deallocate(p, sizes[i], 64);
+  }
+}
+
+void TestOmpMemoryResource(void)
+{
+  TestOmpMemoryResourceAllocates<thrust::system::omp::memory_resource>();
+  TestOmpMemoryResourceAllocates<thrust::system::omp::interleaved_memory_resource>();
+}
+DECLARE_UNITTEST(TestOmpMemoryResource);
+
+
+void TestOmpVectorLargeConstructAndResize(void)
+{
+  // large enough to be mapped and initialized by every thread
+  const std::size_t n = 4 << 20;
+
+  thrust::omp::vector<int> v(n);
+  ASSERT_EQUAL(thrust::count(v.begin(), v.end(), 0), static_cast<std::ptrdiff_t>(n));
+
+  thrust::omp::vector<int, thrust::omp::interleaved_allocator<int> > w(n, 13);
+  ASSERT_EQUAL(thrust::count(w.begin(), w.end(), 13), static_cast<std::ptrdiff_t>(n));
+
+  w.resize(2 * n, 7);
+  ASSERT_EQUAL(thrust::count(w.begin(), w.end(), 13), static_cast<std::ptrdiff_t>(n));
+  ASSERT_EQUAL(thrust::count(w.begin(), w.end(), 7), static_cast<std::ptrdiff_t>(n));
+}
+DECLARE_UNITTEST(TestOmpVectorLargeConstructAndResize);
+
+
+void TestOmpInterleavedMemoryResourceLargeBlocks(void)
+{
+  typedef thrust::system::omp::detail::numa_resource<thrust::system::omp::detail::numa_interleaved> numa_resource;
+
+  numa_resource resource;
+
+  // the smallest block which is mapped and interleaved, and one whose
+  // alignment exceeds a page, so that it falls back to the heap
+  const std::size_t bytes         = numa_resource::min_mapped_bytes;
+  const std::size_t alignments[] = { THRUST_MR_DEFAULT_ALIGNMENT, std::size_t(1) << 16 };
+
+  for(std::size_t i = 0; i < sizeof(alignments) / sizeof(*alignments); ++i)
+  {
+    char *p = static_cast<char *>(resource.do_allocate(bytes, alignments[i]));
+
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(p) % alignments[i], 0u);
+
+#if defined(__linux__)
+    const bool mapped = alignments[i] <= static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+    // fresh pages start out on a page boundary
+    if(mapped)
+    {
+      ASSERT_EQUAL(reinterpret_cast<std::size_t>(p) % sysconf(_SC_PAGESIZE), 0u);
+    }
+
+    int mode = -1;
+
+    if(mapped && syscall(SYS_get_mempolicy, &mode, 0, 0, p, MPOL_F_ADDR) == 0)
+    {
+      ASSERT_EQUAL(mode, MPOL_INTERLEAVE);
+    }
+#endif
+
+    // every page is writable and keeps what's written to it
+    for(std::size_t j = 0; j < bytes; j += 4096)
+    {
+      p[j] = static_cast<char>(j / 4096);
+    }
+
+    p[bytes - 1] = 13;
+
+    for(std::size_t j = 0; j < bytes; j += 4096)
+    {
+      ASSERT_EQUAL(p[j], static_cast<char>(j / 4096));
+    }
+
+    ASSERT_EQUAL(p[bytes - 1], 13);
+
+    resource.do_deallocate(p, bytes, alignments[i]);
+  }
+}
+DECLARE_UNITTEST(TestOmpInterleavedMemoryResourceLargeBlocks);
+
+
+#if defined(__linux__)
+void TestOmpInterleavedMemoryResourcePolicy(void)
+{
+  thrust::system::omp::interleaved_memory_resource resource;
+
+  const std::size_t bytes = 8 << 20;
+
+  thrust::omp::pointer<void> p = resource.allocate(bytes);
+
+  // even a host with a single node reports the policy of the pages, unless it
+  // refuses memory policies altogether
+  int mode = -1;
+
+  if(syscall(SYS_get_mempolicy, &mode, 0, 0, p.get(), MPOL_F_ADDR) == 0)
+  {
+    ASSERT_EQUAL(mode, MPOL_INTERLEAVE);
+  }
+
+  thrust::system::omp::memory_resource first_touch;
+
+  thrust::omp::pointer<void> q = first_touch.allocate(bytes);
+
+  if(syscall(SYS_get_mempolicy, &mode, 0, 0, q.get(), MPOL_F_ADDR) == 0)
+  {
+    ASSERT_EQUAL(mode, MPOL_DEFAULT);
+  }
+
+  first_touch.deallocate(q, bytes);
+  resource.deallocate(p, bytes);
+}
+DECLARE_UNITTEST(TestOmpInterleavedMemoryResourcePolicy);
+#endif
@@ -0,0 +1,85 @@
+#include <unittest/unittest.h>
+
+#include <thrust/functional.h>
+#include <thrust/merge.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+template<typename T>
+void TestOmpMerge(const size_t n)
+{
+  // inputs of different lengths, so that the tiles cut them unevenly
+  thrust::host_vector<T> h_a = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_b = unittest::random_integers<T>(n / 3 + 1);
+
+  thrust::sort(h_a.begin(), h_a.end());
+  thrust::sort(h_b.begin(), h_b.end());
+
+  thrust::host_vector<T> h_result(h_a.size() + h_b.size());
+  thrust::host_vector<T> h_reference(h_a.size() + h_b.size());
+
+  thrust::merge(thrust::omp::par, h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_result.begin());
+  thrust::merge(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_reference.begin());
+
+  ASSERT_EQUAL(h_result, h_reference);
+
+  thrust::merge(thrust::omp::par, h_b.begin(), h_b.end(), h_a.begin(), h_a.end(), h_result.begin());
+  thrust::merge(h_b.begin(), h_b.end(), h_a.begin(), h_a.end(), h_reference.begin());
+
+  ASSERT_EQUAL(h_result, h_reference);
+
+  thrust::sort(h_a.begin(), h_a.end(), thrust::greater<T>());
+  thrust::sort(h_b.begin(), h_b.end(), thrust::greater<T>());
+
+  thrust::merge(thrust::omp::par, h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_result.begin(), thrust::greater<T>());
+  thrust::merge(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_reference.begin(), thrust::greater<T>());
+
+  ASSERT_EQUAL(h_result, h_reference);
+}
+DECLARE_VARIABLE_UNITTEST(TestOmpMerge);
+
+
+template<typename T>
+void TestOmpMergeByKey(const size_t n)
+{
+  // few distinct keys, so that runs of equal keys cross the tiles, and the
+  // values show which input each key was taken from
+  thrust::host_vector<T> h_a_keys = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_b_keys = unittest::random_integers<T>(n / 2 + 1);
+
+  for(size_t i = 0; i < h_a_keys.size(); ++i)
+  {
+    h_a_keys[i] = static_cast<T>(h_a_keys[i] % 4);
+  }
+
+  for(size_t i = 0; i < h_b_keys.size(); ++i)
+  {
+    h_b_keys[i] = static_cast<T>(h_b_keys[i] % 4);
+  }
+
+  thrust::sort(h_a_keys.begin(), h_a_keys.end());
+  thrust::sort(h_b_keys.begin(), h_b_keys.end());
+
+  thrust::host_vector<int> h_a_vals(h_a_keys.size());
+  thrust::host_vector<int> h_b_vals(h_b_keys.size());
+  thrust::sequence(h_a_vals.begin(), h_a_vals.end());
+  thrust::sequence(h_b_vals.begin(), h_b_vals.end(), -static_cast<int>(h_b_vals.size()));
+
+  const size_t m = h_a_keys.size() + h_b_keys.size();
+
+  thrust::host_vector<T>   h_keys_result(m), h_keys_reference(m);
+  thrust::host_vector<int> h_vals_result(m), h_vals_reference(m);
+
+  thrust::merge_by_key(thrust::omp::par,
+                       h_a_keys.begin(), h_a_keys.end(), h_b_keys.begin(), h_b_keys.end(),
+                       h_a_vals.begin(), h_b_vals.begin(),
+                       h_keys_result.begin(), h_vals_result.begin());
+  thrust::merge_by_key(h_a_keys.begin(), h_a_keys.end(), h_b_keys.begin(), h_b_keys.end(),
+                       h_a_vals.begin(), h_b_vals.begin(),
+                       h_keys_reference.begin(), h_vals_reference.begin());
+
+  ASSERT_EQUAL(h_keys_result, h_keys_reference);
+  ASSERT_EQUAL(h_vals_result, h_vals_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpMergeByKey);
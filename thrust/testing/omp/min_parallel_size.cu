@@ -0,0 +1,96 @@
+#include <unittest/unittest.h>
+
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <omp.h>
+
+struct record_parallel
+{
+  int *in_parallel;
+
+  record_parallel(int *in_parallel) : in_parallel(in_parallel) {}
+
+  int operator()(int x) const
+  {
+    if(omp_in_parallel())
+    {
+      THRUST_PRAGMA_OMP(atomic write)
+      *in_parallel = 1;
+    }
+
+    return x;
+  }
+};
+
+
+void TestOmpMinParallelSizeRunsSmallInputsSequentially(void)
+{
+  thrust::host_vector<int> h_input(100000, 1);
+
+  // a handful of elements isn't worth a parallel region
+  int in_parallel = 0;
+  thrust::transform_reduce(thrust::omp::par, h_input.begin(), h_input.begin() + 10, record_parallel(&in_parallel), 0, thrust::plus<int>());
+
+  ASSERT_EQUAL(in_parallel, 0);
+
+  // nor is any input smaller than the policy's cutoff, which for_each only
+  // has when the policy sets one
+  thrust::for_each(thrust::omp::par.min_parallel_size(h_input.size() + 1), h_input.begin(), h_input.end(), record_parallel(&in_parallel));
+
+  ASSERT_EQUAL(in_parallel, 0);
+
+  thrust::for_each(thrust::omp::par.on(2).min_parallel_size(h_input.size() + 1), h_input.begin(), h_input.end(), record_parallel(&in_parallel));
+
+  ASSERT_EQUAL(in_parallel, 0);
+}
+DECLARE_UNITTEST(TestOmpMinParallelSizeRunsSmallInputsSequentially);
+
+
+template<typename T>
+struct TestOmpMinParallelSize
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+    // parallelize whatever can be, however small
+    for(size_t min_size = 1; min_size <= 1024; min_size *= 32)
+    {
+      ASSERT_EQUAL(thrust::reduce(thrust::omp::par.min_parallel_size(min_size), h_input.begin(), h_input.end()),
+                   thrust::reduce(h_input.begin(), h_input.end()));
+
+      thrust::host_vector<T> h_result(n);
+      thrust::host_vector<T> h_reference(n);
+
+      thrust::inclusive_scan(thrust::omp::par.min_parallel_size(min_size), h_input.begin(), h_input.end(), h_result.begin());
+      thrust::inclusive_scan(h_input.begin(), h_input.end(), h_reference.begin());
+
+      ASSERT_EQUAL(h_result, h_reference);
+
+      h_result    = h_input;
+      h_reference = h_input;
+
+      thrust::stable_sort(thrust::omp::par.schedule(thrust::omp::schedule_dynamic).min_parallel_size(min_size), h_result.begin(), h_result.end());
+      thrust::stable_sort(h_reference.begin(), h_reference.end());
+
+      ASSERT_EQUAL(h_result, h_reference);
+
+      thrust::host_vector<T> h_merged(2 * n);
+      thrust::host_vector<T> h_merged_reference(2 * n);
+
+      thrust::merge(thrust::omp::par.min_parallel_size(min_size), h_result.begin(), h_result.end(), h_reference.begin(), h_reference.end(), h_merged.begin());
+      thrust::merge(h_result.begin(), h_result.end(), h_reference.begin(), h_reference.end(), h_merged_reference.begin());
+
+      ASSERT_EQUAL(h_merged, h_merged_reference);
+    }
+  }
+};
+VariableUnitTest<TestOmpMinParallelSize, IntegralTypes> TestOmpMinParallelSizeInstance;
+
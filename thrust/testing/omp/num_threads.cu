@@ -0,0 +1,80 @@
+#include <unittest/unittest.h>
+
+#include <thrust/for_each.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <omp.h>
+
+struct record_team_size
+{
+  int *team_size;
+
+  record_team_size(int *team_size) : team_size(team_size) {}
+
+  void operator()(int) const
+  {
+    const int n = omp_get_num_threads();
+
+    THRUST_PRAGMA_OMP(critical)
+    {
+      if(n > *team_size)
+      {
+        *team_size = n;
+      }
+    }
+  }
+};
+
+
+void TestOmpNumThreadsLimitsTeam(void)
+{
+  thrust::host_vector<int> h_input(10000, 1);
+
+  const int saved_max_threads = omp_get_max_threads();
+
+  int team_size = 0;
+  thrust::for_each(thrust::omp::par.on(2), h_input.begin(), h_input.end(), record_team_size(&team_size));
+
+  ASSERT_EQUAL(true, team_size >= 1 && team_size <= 2);
+
+  // the calling thread's setting is restored afterwards
+  ASSERT_EQUAL(omp_get_max_threads(), saved_max_threads);
+}
+DECLARE_UNITTEST(TestOmpNumThreadsLimitsTeam);
+
+
+template<typename T>
+struct TestOmpNumThreads
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+    for(int num_threads = 1; num_threads <= 3; ++num_threads)
+    {
+      ASSERT_EQUAL(thrust::reduce(thrust::omp::par.on(num_threads), h_input.begin(), h_input.end()),
+                   thrust::reduce(h_input.begin(), h_input.end()));
+
+      thrust::host_vector<T> h_result(n);
+      thrust::host_vector<T> h_reference(n);
+
+      thrust::inclusive_scan(thrust::omp::par.on(num_threads), h_input.begin(), h_input.end(), h_result.begin());
+      thrust::inclusive_scan(h_input.begin(), h_input.end(), h_reference.begin());
+
+      ASSERT_EQUAL(h_result, h_reference);
+
+      h_result    = h_input;
+      h_reference = h_input;
+
+      thrust::stable_sort(thrust::omp::par.on(num_threads).schedule(thrust::omp::schedule_dynamic), h_result.begin(), h_result.end());
+      thrust::stable_sort(h_reference.begin(), h_reference.end());
+
+      ASSERT_EQUAL(h_result, h_reference);
+    }
+  }
+};
+VariableUnitTest<TestOmpNumThreads, IntegralTypes> TestOmpNumThreadsInstance;
+
@@ -0,0 +1,67 @@
+#include <unittest/unittest.h>
+
+#include <thrust/fill.h>
+#include <thrust/partition.h>
+#include <thrust/system/omp/execution_policy.h>
+
+template<typename T>
+struct is_even
+{
+  bool operator()(T x) const
+  {
+    return (x & 1) == 0;
+  }
+};
+
+
+template<typename T>
+void TestOmpStablePartition(const size_t n)
+{
+  thrust::host_vector<T> h_data      = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_reference = h_data;
+
+  typename thrust::host_vector<T>::iterator h_middle =
+    thrust::stable_partition(thrust::omp::par, h_data.begin(), h_data.end(), is_even<T>());
+  typename thrust::host_vector<T>::iterator h_reference_middle =
+    thrust::stable_partition(h_reference.begin(), h_reference.end(), is_even<T>());
+
+  // the falses are moved back behind the trues in their original order
+  ASSERT_EQUAL(h_middle - h_data.begin(), h_reference_middle - h_reference.begin());
+  ASSERT_EQUAL(h_data, h_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpStablePartition);
+
+
+template<typename T>
+void TestOmpStablePartitionStencil(const size_t n)
+{
+  thrust::host_vector<T>   h_data      = unittest::random_integers<T>(n);
+  thrust::host_vector<int> h_stencil   = unittest::random_integers<int>(n);
+  thrust::host_vector<T>   h_reference = h_data;
+
+  typename thrust::host_vector<T>::iterator h_middle =
+    thrust::stable_partition(thrust::omp::par, h_data.begin(), h_data.end(), h_stencil.begin(), is_even<int>());
+  typename thrust::host_vector<T>::iterator h_reference_middle =
+    thrust::stable_partition(h_reference.begin(), h_reference.end(), h_stencil.begin(), is_even<int>());
+
+  ASSERT_EQUAL(h_middle - h_data.begin(), h_reference_middle - h_reference.begin());
+  ASSERT_EQUAL(h_data, h_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpStablePartitionStencil);
+
+
+template<typename T>
+void TestOmpStablePartitionAllOrNone(const size_t n)
+{
+  // no falses to buffer, and no trues to join
+  thrust::host_vector<T> h_data(n, T(2));
+
+  ASSERT_EQUAL_QUIET(thrust::stable_partition(thrust::omp::par, h_data.begin(), h_data.end(), is_even<T>()), h_data.end());
+  ASSERT_EQUAL(h_data, thrust::host_vector<T>(n, T(2)));
+
+  thrust::fill(h_data.begin(), h_data.end(), T(3));
+
+  ASSERT_EQUAL_QUIET(thrust::stable_partition(thrust::omp::par, h_data.begin(), h_data.end(), is_even<T>()), h_data.begin());
+  ASSERT_EQUAL(h_data, thrust::host_vector<T>(n, T(3)));
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpStablePartitionAllOrNone);
@@ -0,0 +1,75 @@
+#include <unittest/unittest.h>
+
+#include <thrust/functional.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+template<typename T>
+void TestOmpRadixSort(const size_t n)
+{
+  // half of the keys negated, so that signed and floating point keys have
+  // both signs
+  thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+
+  for(size_t i = 0; i < n; i += 2)
+  {
+    h_keys[i] = static_cast<T>(-h_keys[i]);
+  }
+
+  thrust::host_vector<T> h_result    = h_keys;
+  thrust::host_vector<T> h_reference = h_keys;
+
+  thrust::stable_sort(thrust::omp::par, h_result.begin(), h_result.end(), thrust::less<T>());
+  thrust::stable_sort(h_reference.begin(), h_reference.end(), thrust::less<T>());
+
+  ASSERT_EQUAL(h_result, h_reference);
+
+  h_result = h_keys;
+
+  thrust::stable_sort(thrust::omp::par, h_result.begin(), h_result.end(), thrust::greater<T>());
+  thrust::stable_sort(h_reference.begin(), h_reference.end(), thrust::greater<T>());
+
+  ASSERT_EQUAL(h_result, h_reference);
+}
+DECLARE_VARIABLE_UNITTEST(TestOmpRadixSort);
+
+
+template<typename T>
+void TestOmpRadixSortByKey(const size_t n)
+{
+  // few distinct keys: the values show whether equal keys kept their order
+  // across tiles, and the passes over the high digits are skipped
+  thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] = static_cast<T>(h_keys[i] % 3);
+  }
+
+  thrust::host_vector<int> h_vals(n);
+  thrust::sequence(h_vals.begin(), h_vals.end());
+
+  thrust::host_vector<T>   h_keys_result    = h_keys;
+  thrust::host_vector<int> h_vals_result    = h_vals;
+  thrust::host_vector<T>   h_keys_reference = h_keys;
+  thrust::host_vector<int> h_vals_reference = h_vals;
+
+  thrust::stable_sort_by_key(thrust::omp::par, h_keys_result.begin(), h_keys_result.end(), h_vals_result.begin(), thrust::less<T>());
+  thrust::stable_sort_by_key(h_keys_reference.begin(), h_keys_reference.end(), h_vals_reference.begin(), thrust::less<T>());
+
+  ASSERT_EQUAL(h_keys_result, h_keys_reference);
+  ASSERT_EQUAL(h_vals_result, h_vals_reference);
+
+  h_keys_result    = h_keys;
+  h_vals_result    = h_vals;
+  h_keys_reference = h_keys;
+  h_vals_reference = h_vals;
+
+  thrust::stable_sort_by_key(thrust::omp::par, h_keys_result.begin(), h_keys_result.end(), h_vals_result.begin(), thrust::greater<T>());
+  thrust::stable_sort_by_key(h_keys_reference.begin(), h_keys_reference.end(), h_vals_reference.begin(), thrust::greater<T>());
+
+  ASSERT_EQUAL(h_keys_result, h_keys_reference);
+  ASSERT_EQUAL(h_vals_result, h_vals_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpRadixSortByKey);
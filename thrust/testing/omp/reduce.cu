@@ -0,0 +1,122 @@
+#include <unittest/unittest.h>
+
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/system/omp/execution_policy.h>
+
+// an associative operator which isn't commutative: the first nonzero operand
+template<typename T>
+struct first_nonzero
+{
+  T operator()(const T &lhs, const T &rhs) const
+  {
+    return lhs != T(0) ? lhs : rhs;
+  }
+};
+
+
+// a 2x2 matrix, whose product is associative but not commutative, and which
+// isn't an arithmetic type
+struct matrix
+{
+  unsigned int a, b, c, d;
+
+  matrix() : a(1), b(0), c(0), d(1) {}
+
+  matrix(unsigned int a, unsigned int b, unsigned int c, unsigned int d) : a(a), b(b), c(c), d(d) {}
+
+  bool operator==(const matrix &other) const
+  {
+    return a == other.a && b == other.b && c == other.c && d == other.d;
+  }
+};
+
+inline std::ostream &operator<<(std::ostream &os, const matrix &m)
+{
+  return os << "[" << m.a << " " << m.b << "; " << m.c << " " << m.d << "]";
+}
+
+struct multiply_matrices
+{
+  matrix operator()(const matrix &lhs, const matrix &rhs) const
+  {
+    return matrix(lhs.a * rhs.a + lhs.b * rhs.c, lhs.a * rhs.b + lhs.b * rhs.d,
+                  lhs.c * rhs.a + lhs.d * rhs.c, lhs.c * rhs.b + lhs.d * rhs.d);
+  }
+};
+
+
+template<typename T>
+void TestOmpReduceVectorized(const size_t n)
+{
+  // the operators which are reduced with the simd construct
+  thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+  ASSERT_EQUAL(thrust::reduce(thrust::omp::par, h_input.begin(), h_input.end(), T(13)),
+               thrust::reduce(h_input.begin(), h_input.end(), T(13)));
+
+  ASSERT_EQUAL(thrust::reduce(thrust::omp::par, h_input.begin(), h_input.end(), T(13), thrust::minimum<T>()),
+               thrust::reduce(h_input.begin(), h_input.end(), T(13), thrust::minimum<T>()));
+
+  ASSERT_EQUAL(thrust::reduce(thrust::omp::par, h_input.begin(), h_input.end(), T(13), thrust::maximum<T>()),
+               thrust::reduce(h_input.begin(), h_input.end(), T(13), thrust::maximum<T>()));
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpReduceVectorized);
+
+
+template<typename T>
+void TestOmpReduceNonCommutative(const size_t n)
+{
+  // the partial sums are reduced in order: with zeros before it, the first
+  // nonzero element is the result wherever it lies
+  thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+  for(size_t i = 0; i < 2 * n / 3; ++i)
+  {
+    h_input[i] = T(0);
+  }
+
+  ASSERT_EQUAL(thrust::reduce(thrust::omp::par, h_input.begin(), h_input.end(), T(0), first_nonzero<T>()),
+               thrust::reduce(h_input.begin(), h_input.end(), T(0), first_nonzero<T>()));
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpReduceNonCommutative);
+
+
+void TestOmpReduceNonArithmetic(const size_t n)
+{
+  // the partial sums of a type which isn't arithmetic live on the heap
+  thrust::host_vector<unsigned int> h_random = unittest::random_integers<unsigned int>(n);
+
+  thrust::host_vector<matrix> h_input(n);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    h_input[i] = matrix(h_random[i] % 7, 1, h_random[i] % 5, 2);
+  }
+
+  ASSERT_EQUAL(thrust::reduce(thrust::omp::par, h_input.begin(), h_input.end(), matrix(), multiply_matrices()),
+               thrust::reduce(h_input.begin(), h_input.end(), matrix(), multiply_matrices()));
+}
+DECLARE_SIZED_UNITTEST(TestOmpReduceNonArithmetic);
+
+
+void TestOmpReduceManyIntervals(const size_t n)
+{
+  // more partial sums than fit on the stack
+  thrust::host_vector<unsigned int> h_input = unittest::random_integers<unsigned int>(n);
+
+  for(size_t i = 0; i < n / 2; ++i)
+  {
+    h_input[i] = 0u;
+  }
+
+  ASSERT_EQUAL(thrust::reduce(thrust::omp::par.on(257), h_input.begin(), h_input.end(), 13u),
+               thrust::reduce(h_input.begin(), h_input.end(), 13u));
+
+  ASSERT_EQUAL(thrust::reduce(thrust::omp::par.on(257), h_input.begin(), h_input.end(), 0u, first_nonzero<unsigned int>()),
+               thrust::reduce(h_input.begin(), h_input.end(), 0u, first_nonzero<unsigned int>()));
+
+  ASSERT_EQUAL(thrust::reduce(thrust::omp::par.on(33).schedule(thrust::omp::schedule_dynamic), h_input.begin(), h_input.end(), 0u, first_nonzero<unsigned int>()),
+               thrust::reduce(h_input.begin(), h_input.end(), 0u, first_nonzero<unsigned int>()));
+}
+DECLARE_SIZED_UNITTEST(TestOmpReduceManyIntervals);
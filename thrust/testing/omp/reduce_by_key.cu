@@ -0,0 +1,78 @@
+#include <unittest/unittest.h>
+
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+template<typename T>
+void TestOmpReduceByKeyWithKeys(const thrust::host_vector<int> &h_keys, const thrust::host_vector<T> &h_vals)
+{
+  typedef thrust::host_vector<int>::iterator         KeyIterator;
+  typedef typename thrust::host_vector<T>::iterator   ValueIterator;
+
+  const size_t n = h_keys.size();
+
+  thrust::host_vector<int> h_keys_output(n), h_keys_reference(n);
+  thrust::host_vector<T>   h_vals_output(n), h_vals_reference(n);
+
+  thrust::pair<KeyIterator, ValueIterator> h_ends =
+    thrust::reduce_by_key(thrust::omp::par, h_keys.begin(), h_keys.end(), h_vals.begin(), h_keys_output.begin(), h_vals_output.begin());
+  thrust::pair<KeyIterator, ValueIterator> h_reference_ends =
+    thrust::reduce_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(), h_keys_reference.begin(), h_vals_reference.begin());
+
+  ASSERT_EQUAL(h_ends.first - h_keys_output.begin(), h_reference_ends.first - h_keys_reference.begin());
+  ASSERT_EQUAL(h_ends.second - h_vals_output.begin(), h_reference_ends.second - h_vals_reference.begin());
+  ASSERT_EQUAL(h_keys_output, h_keys_reference);
+  ASSERT_EQUAL(h_vals_output, h_vals_reference);
+
+  // the segments which span tiles are joined in order: project1st keeps
+  // the first value of each segment
+  h_ends = thrust::reduce_by_key(thrust::omp::par, h_keys.begin(), h_keys.end(), h_vals.begin(),
+                                 h_keys_output.begin(), h_vals_output.begin(),
+                                 thrust::equal_to<int>(), thrust::project1st<T,T>());
+  h_reference_ends = thrust::reduce_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(),
+                                           h_keys_reference.begin(), h_vals_reference.begin(),
+                                           thrust::equal_to<int>(), thrust::project1st<T,T>());
+
+  ASSERT_EQUAL(h_ends.first - h_keys_output.begin(), h_reference_ends.first - h_keys_reference.begin());
+  ASSERT_EQUAL(h_keys_output, h_keys_reference);
+  ASSERT_EQUAL(h_vals_output, h_vals_reference);
+}
+
+
+template<typename T>
+void TestOmpReduceByKey(const size_t n)
+{
+  thrust::host_vector<T>   h_vals = unittest::random_integers<T>(n);
+  thrust::host_vector<int> h_keys(n);
+
+  // short segments, which each tile holds many of
+  for(size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] = static_cast<int>(i / 3);
+  }
+
+  TestOmpReduceByKeyWithKeys(h_keys, h_vals);
+
+  // a few long segments, which span several tiles
+  h_keys = unittest::random_integers<int>(n);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] %= 5;
+  }
+
+  thrust::sort(h_keys.begin(), h_keys.end());
+
+  TestOmpReduceByKeyWithKeys(h_keys, h_vals);
+
+  // a single segment spanning every tile, and one segment per element
+  TestOmpReduceByKeyWithKeys(thrust::host_vector<int>(n, 7), h_vals);
+
+  thrust::sequence(h_keys.begin(), h_keys.end());
+
+  TestOmpReduceByKeyWithKeys(h_keys, h_vals);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpReduceByKey);
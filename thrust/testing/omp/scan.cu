@@ -0,0 +1,83 @@
+#include <unittest/unittest.h>
+
+#include <thrust/fill.h>
+#include <thrust/scan.h>
+#include <thrust/system/omp/execution_policy.h>
+
+// an associative operator which isn't commutative: the first nonzero operand
+template<typename T>
+struct first_nonzero
+{
+  T operator()(const T &lhs, const T &rhs) const
+  {
+    return lhs != T(0) ? lhs : rhs;
+  }
+};
+
+
+template<typename T>
+void TestOmpInclusiveScan(const size_t n)
+{
+  thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T> h_output(n);
+  thrust::host_vector<T> h_reference(n);
+
+  thrust::inclusive_scan(thrust::omp::par, h_input.begin(), h_input.end(), h_output.begin());
+  thrust::inclusive_scan(h_input.begin(), h_input.end(), h_reference.begin());
+
+  ASSERT_EQUAL(h_output, h_reference);
+
+  // in place
+  h_output = h_input;
+  thrust::inclusive_scan(thrust::omp::par, h_output.begin(), h_output.end(), h_output.begin());
+
+  ASSERT_EQUAL(h_output, h_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpInclusiveScan);
+
+
+template<typename T>
+void TestOmpExclusiveScan(const size_t n)
+{
+  thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T> h_output(n);
+  thrust::host_vector<T> h_reference(n);
+
+  thrust::exclusive_scan(thrust::omp::par, h_input.begin(), h_input.end(), h_output.begin(), T(13));
+  thrust::exclusive_scan(h_input.begin(), h_input.end(), h_reference.begin(), T(13));
+
+  ASSERT_EQUAL(h_output, h_reference);
+
+  // in place
+  h_output = h_input;
+  thrust::exclusive_scan(thrust::omp::par, h_output.begin(), h_output.end(), h_output.begin(), T(13));
+
+  ASSERT_EQUAL(h_output, h_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpExclusiveScan);
+
+
+template<typename T>
+void TestOmpScanNonCommutative(const size_t n)
+{
+  // the first half is zero, so the carry of each tile differs from its
+  // own elements until the first nonzero one
+  thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+  thrust::fill(h_input.begin(), h_input.begin() + n / 2, T(0));
+
+  thrust::host_vector<T> h_output(n);
+  thrust::host_vector<T> h_reference(n);
+
+  thrust::inclusive_scan(thrust::omp::par, h_input.begin(), h_input.end(), h_output.begin(), first_nonzero<T>());
+  thrust::inclusive_scan(h_input.begin(), h_input.end(), h_reference.begin(), first_nonzero<T>());
+
+  ASSERT_EQUAL(h_output, h_reference);
+
+  thrust::exclusive_scan(thrust::omp::par, h_input.begin(), h_input.end(), h_output.begin(), T(0), first_nonzero<T>());
+  thrust::exclusive_scan(h_input.begin(), h_input.end(), h_reference.begin(), T(0), first_nonzero<T>());
+
+  ASSERT_EQUAL(h_output, h_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpScanNonCommutative);
@@ -0,0 +1,100 @@
+#include <unittest/unittest.h>
+
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+#include <thrust/system/omp/execution_policy.h>
+
+template<typename T>
+struct mark_functor
+{
+  T *marks;
+
+  mark_functor(T *marks) : marks(marks) {}
+
+  void operator()(T x) const
+  {
+    marks[x] += 1;
+  }
+};
+
+
+template<typename T>
+void TestOmpSchedule(thrust::omp::schedule_kind kind, int chunk_size, size_t n)
+{
+  thrust::host_vector<T> h_input(n);
+  thrust::sequence(h_input.begin(), h_input.end());
+
+  // for_each visits every element exactly once
+  thrust::host_vector<T> marks(n, T(0));
+  thrust::for_each(thrust::omp::par.schedule(kind, chunk_size),
+                   h_input.begin(), h_input.end(),
+                   mark_functor<T>(thrust::raw_pointer_cast(marks.data())));
+
+  ASSERT_EQUAL(marks, thrust::host_vector<T>(n, T(1)));
+
+  // transform
+  thrust::host_vector<T> h_result(n);
+  thrust::transform(thrust::omp::par.schedule(kind, chunk_size),
+                    h_input.begin(), h_input.end(), h_result.begin(), thrust::negate<T>());
+
+  thrust::host_vector<T> h_reference(n);
+  thrust::transform(h_input.begin(), h_input.end(), h_reference.begin(), thrust::negate<T>());
+
+  ASSERT_EQUAL(h_result, h_reference);
+
+  // tabulate
+  thrust::tabulate(thrust::omp::par.schedule(kind, chunk_size),
+                   h_result.begin(), h_result.end(), thrust::negate<T>());
+
+  ASSERT_EQUAL(h_result, h_reference);
+
+  // reduce
+  T sum = thrust::reduce(thrust::omp::par.schedule(kind, chunk_size),
+                         h_input.begin(), h_input.end(), T(13));
+
+  ASSERT_EQUAL(sum, thrust::reduce(h_input.begin(), h_input.end(), T(13)));
+}
+
+
+void TestOmpScheduleStatic(void)
+{
+  TestOmpSchedule<int>(thrust::omp::schedule_static, 0, 10000);
+  TestOmpSchedule<int>(thrust::omp::schedule_static, 7, 10000);
+}
+DECLARE_UNITTEST(TestOmpScheduleStatic);
+
+
+void TestOmpScheduleDynamic(void)
+{
+  TestOmpSchedule<int>(thrust::omp::schedule_dynamic, 0, 10000);
+  TestOmpSchedule<int>(thrust::omp::schedule_dynamic, 64, 10000);
+  TestOmpSchedule<int>(thrust::omp::schedule_dynamic, 64, 3);
+}
+DECLARE_UNITTEST(TestOmpScheduleDynamic);
+
+
+void TestOmpScheduleGuided(void)
+{
+  TestOmpSchedule<int>(thrust::omp::schedule_guided, 0, 10000);
+  TestOmpSchedule<int>(thrust::omp::schedule_guided, 16, 10000);
+}
+DECLARE_UNITTEST(TestOmpScheduleGuided);
+
+
+void TestOmpScheduleWithAllocator(void)
+{
+  std::allocator<int> alloc;
+
+  thrust::host_vector<int> h_input(1000, 1);
+
+  int sum = thrust::reduce(thrust::omp::par(alloc).schedule(thrust::omp::schedule_dynamic, 8),
+                           h_input.begin(), h_input.end());
+
+  ASSERT_EQUAL(sum, 1000);
+}
+DECLARE_UNITTEST(TestOmpScheduleWithAllocator);
+
@@ -0,0 +1,91 @@
+#include <unittest/unittest.h>
+
+#include <thrust/functional.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+// orders keys by their tens only, so that runs of keys are equivalent
+template<typename T>
+struct less_tens
+{
+  bool operator()(T lhs, T rhs) const
+  {
+    return lhs / 10 < rhs / 10;
+  }
+};
+
+template<typename T>
+void TestOmpStableSort(const size_t n)
+{
+  thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T> h_result    = h_keys;
+  thrust::host_vector<T> h_reference = h_keys;
+
+  thrust::stable_sort(thrust::omp::par, h_result.begin(), h_result.end());
+  thrust::stable_sort(h_reference.begin(), h_reference.end());
+
+  ASSERT_EQUAL(h_result, h_reference);
+
+  // sorting sorted runs merges them back in place
+  thrust::stable_sort(thrust::omp::par, h_result.begin(), h_result.end(), thrust::greater<T>());
+  thrust::stable_sort(h_reference.begin(), h_reference.end(), thrust::greater<T>());
+
+  ASSERT_EQUAL(h_result, h_reference);
+}
+DECLARE_VARIABLE_UNITTEST(TestOmpStableSort);
+
+
+template<typename T>
+void TestOmpStableSortByKey(const size_t n)
+{
+  // few distinct keys, so that runs of equal keys span several tiles and
+  // the values show whether they kept their order
+  thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] = static_cast<T>(h_keys[i] % 3);
+  }
+
+  thrust::host_vector<int> h_vals(n);
+  thrust::sequence(h_vals.begin(), h_vals.end());
+
+  thrust::host_vector<T>   h_keys_reference = h_keys;
+  thrust::host_vector<int> h_vals_reference = h_vals;
+
+  thrust::stable_sort_by_key(thrust::omp::par, h_keys.begin(), h_keys.end(), h_vals.begin());
+  thrust::stable_sort_by_key(h_keys_reference.begin(), h_keys_reference.end(), h_vals_reference.begin());
+
+  ASSERT_EQUAL(h_keys, h_keys_reference);
+  ASSERT_EQUAL(h_vals, h_vals_reference);
+
+  thrust::stable_sort_by_key(thrust::omp::par, h_keys.begin(), h_keys.end(), h_vals.begin(), thrust::greater<T>());
+  thrust::stable_sort_by_key(h_keys_reference.begin(), h_keys_reference.end(), h_vals_reference.begin(), thrust::greater<T>());
+
+  ASSERT_EQUAL(h_keys, h_keys_reference);
+  ASSERT_EQUAL(h_vals, h_vals_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpStableSortByKey);
+
+
+template<typename T>
+void TestOmpStableSortByKeyEquivalentKeys(const size_t n)
+{
+  // equivalent keys which aren't equal must keep their order too
+  thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+
+  thrust::host_vector<int> h_vals(n);
+  thrust::sequence(h_vals.begin(), h_vals.end());
+
+  thrust::host_vector<T>   h_keys_reference = h_keys;
+  thrust::host_vector<int> h_vals_reference = h_vals;
+
+  thrust::stable_sort_by_key(thrust::omp::par, h_keys.begin(), h_keys.end(), h_vals.begin(), less_tens<T>());
+  thrust::stable_sort_by_key(h_keys_reference.begin(), h_keys_reference.end(), h_vals_reference.begin(), less_tens<T>());
+
+  ASSERT_EQUAL(h_keys, h_keys_reference);
+  ASSERT_EQUAL(h_vals, h_vals_reference);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpStableSortByKeyEquivalentKeys);
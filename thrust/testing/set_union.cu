@@ -6,6 +6,8 @@
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/retag.h>
 
+#include <algorithm>
+
 
 template<typename InputIterator1,
          typename InputIterator2,
@@ -120,7 +122,8 @@ DECLARE_VECTOR_UNITTEST(TestSetUnionWithEquivalentElementsSimple);
 template<typename T>
 void TestSetUnion(const size_t n)
 {
-  size_t sizes[]   = {0, 1, n / 2, n, n + 1, 2 * n};
+  // the host systems gallop over the longer of uneven inputs
+  size_t sizes[]   = {0, 1, n / 64, n / 8, n / 2, n, n + 1, 2 * n};
   size_t num_sizes = sizeof(sizes) / sizeof(size_t);
 
   thrust::host_vector<T> random = unittest::random_integers<unittest::int8_t>(n + *thrust::max_element(sizes, sizes + num_sizes));
@@ -155,6 +158,36 @@ void TestSetUnion(const size_t n)
     d_result.resize(d_end - d_result.begin());
 
     ASSERT_EQUAL(h_result, d_result);
+
+    thrust::host_vector<T> reference(n + size);
+
+    reference.resize(std::set_union(h_a.begin(), h_a.end(),
+                                    h_b.begin(), h_b.begin() + size,
+                                    reference.begin()) - reference.begin());
+
+    ASSERT_EQUAL(reference, h_result);
+
+    // and with the shorter input first
+    reference.resize(n + size);
+    h_result.resize(n + size);
+    d_result.resize(n + size);
+
+    reference.resize(std::set_union(h_b.begin(), h_b.begin() + size,
+                                    h_a.begin(), h_a.end(),
+                                    reference.begin()) - reference.begin());
+
+    h_end = thrust::set_union(h_b.begin(), h_b.begin() + size,
+                              h_a.begin(), h_a.end(),
+                              h_result.begin());
+    h_result.resize(h_end - h_result.begin());
+
+    d_end = thrust::set_union(d_b.begin(), d_b.begin() + size,
+                              d_a.begin(), d_a.end(),
+                              d_result.begin());
+    d_result.resize(d_end - d_result.begin());
+
+    ASSERT_EQUAL(reference, h_result);
+    ASSERT_EQUAL(reference, d_result);
   }
 }
 DECLARE_VARIABLE_UNITTEST(TestSetUnion);
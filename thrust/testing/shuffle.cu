@@ -375,6 +375,38 @@ void TestHostDeviceIdentical(size_t m) {
 }
 DECLARE_VARIABLE_UNITTEST(TestHostDeviceIdentical);
 
+// The systems with their own shuffle_copy compute the same permutation as the
+// generic one, so the same engine shuffles alike on all of them
+template <typename T>
+void TestShuffleCopyMatchesGeneric(size_t m) {
+  thrust::host_vector<T> h_data(m);
+  thrust::sequence(h_data.begin(), h_data.end(), T{});
+  thrust::device_vector<T> d_data = h_data;
+
+  thrust::host_vector<T> reference(m);
+  thrust::host_vector<T> h_result(m);
+  thrust::device_vector<T> d_result(m);
+
+  thrust::default_random_engine reference_g(0xD5);
+  thrust::default_random_engine host_g(0xD5);
+  thrust::default_random_engine device_g(0xD5);
+
+  auto policy = thrust::host;
+  thrust::system::detail::generic::shuffle_copy(policy, h_data.begin(), h_data.end(), reference.begin(), reference_g);
+
+  thrust::shuffle_copy(h_data.begin(), h_data.end(), h_result.begin(), host_g);
+  thrust::shuffle_copy(d_data.begin(), d_data.end(), d_result.begin(), device_g);
+
+  ASSERT_EQUAL(h_result, reference);
+  ASSERT_EQUAL(d_result, reference);
+
+  // and leave the engines in the same state
+  const auto next = reference_g();
+  ASSERT_EQUAL(host_g(), next);
+  ASSERT_EQUAL(device_g(), next);
+}
+DECLARE_VARIABLE_UNITTEST(TestShuffleCopyMatchesGeneric);
+
 template <typename T>
 void TestFunctionIsBijection(size_t m) {
   thrust::default_random_engine device_g(0xD5);
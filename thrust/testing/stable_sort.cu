@@ -3,6 +3,8 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
 
+#include <algorithm>
+
 
 template<typename RandomAccessIterator>
 void stable_sort(my_system &system, RandomAccessIterator, RandomAccessIterator)
@@ -173,3 +175,26 @@ void TestStableSortWithIndirection(void)
 }
 DECLARE_INTEGRAL_VECTOR_UNITTEST(TestStableSortWithIndirection);
 
+
+
+template <typename T>
+void _TestStableSortWideDigits(size_t n)
+{
+    thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+    thrust::host_vector<T> reference = h_data;
+    std::sort(reference.begin(), reference.end());
+
+    thrust::stable_sort(h_data.begin(), h_data.end());
+
+    ASSERT_EQUAL(reference, h_data);
+}
+
+void TestStableSortWideDigits(void)
+{
+    // large enough that a radix sort takes wide digits and writes through
+    // the staging buffers of its buckets
+    _TestStableSortWideDigits<unittest::int32_t>(1 << 22);
+    _TestStableSortWideDigits<unittest::uint64_t>(1 << 21);
+}
+DECLARE_UNITTEST(TestStableSortWideDigits);
@@ -1,8 +1,13 @@
 #include <unittest/unittest.h>
 #include <thrust/sort.h>
 #include <thrust/functional.h>
+#include <thrust/sequence.h>
 #include <thrust/iterator/retag.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 
 template<typename RandomAccessIterator1, typename RandomAccessIterator2>
 void stable_sort_by_key(my_system &system, RandomAccessIterator1, RandomAccessIterator1, RandomAccessIterator2)
@@ -136,3 +141,51 @@ struct TestStableSortByKeySemantics
 };
 VariableUnitTest<TestStableSortByKeySemantics, unittest::type_list<unittest::uint8_t,unittest::uint16_t,unittest::uint32_t> > TestStableSortByKeySemanticsInstance;
 
+
+
+template <typename K, typename V>
+struct less_first
+{
+  bool operator()(const std::pair<K,V> &lhs, const std::pair<K,V> &rhs) const {return lhs.first < rhs.first;}
+};
+
+template <typename K, typename V>
+void _TestStableSortByKeyManyBuckets(size_t n)
+{
+    thrust::host_vector<K> h_keys = unittest::random_integers<K>(n);
+
+    thrust::host_vector<V> h_values(n);
+    thrust::sequence(h_values.begin(), h_values.end());
+
+    // a stable reference, whose values tell equal keys apart
+    std::vector< std::pair<K,V> > reference(n);
+
+    for(size_t i = 0; i < n; i++)
+        reference[i] = std::make_pair(h_keys[i], h_values[i]);
+
+    std::stable_sort(reference.begin(), reference.end(), less_first<K,V>());
+
+    thrust::host_vector<K> reference_keys(n);
+    thrust::host_vector<V> reference_values(n);
+
+    for(size_t i = 0; i < n; i++)
+    {
+        reference_keys[i]   = reference[i].first;
+        reference_values[i] = reference[i].second;
+    }
+
+    thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin());
+
+    ASSERT_EQUAL(reference_keys,   h_keys);
+    ASSERT_EQUAL(reference_values, h_values);
+}
+
+void TestStableSortByKeyManyBuckets(void)
+{
+    // large enough that the passes of a radix sort write through the
+    // staging buffers of its buckets
+    _TestStableSortByKeyManyBuckets<unittest::int16_t, unsigned int>(1 << 18);
+    _TestStableSortByKeyManyBuckets<unittest::int32_t, unsigned int>(1 << 18);
+    _TestStableSortByKeyManyBuckets<unittest::uint64_t, unsigned int>(1 << 18);
+}
+DECLARE_UNITTEST(TestStableSortByKeyManyBuckets);
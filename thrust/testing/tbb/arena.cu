@@ -0,0 +1,74 @@
+#include <unittest/unittest.h>
+
+#include <thrust/for_each.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <tbb/task_arena.h>
+
+#include <atomic>
+
+struct record_concurrency
+{
+  std::atomic<int> *concurrency;
+
+  record_concurrency(std::atomic<int> *concurrency) : concurrency(concurrency) {}
+
+  void operator()(int) const
+  {
+    const int n = ::tbb::this_task_arena::max_concurrency();
+
+    int seen = concurrency->load();
+    while(n > seen && !concurrency->compare_exchange_weak(seen, n))
+    {}
+  }
+};
+
+
+void TestTbbArenaRunsAlgorithms(void)
+{
+  ::tbb::task_arena arena(2);
+
+  thrust::host_vector<int> h_input(10000, 1);
+
+  std::atomic<int> concurrency(0);
+  thrust::for_each(thrust::tbb::par.on(arena), h_input.begin(), h_input.end(), record_concurrency(&concurrency));
+
+  ASSERT_EQUAL(concurrency.load(), 2);
+}
+DECLARE_UNITTEST(TestTbbArenaRunsAlgorithms);
+
+
+template<typename T>
+struct TestTbbArena
+{
+  void operator()(const size_t n)
+  {
+    ::tbb::task_arena arena(2);
+
+    thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+    ASSERT_EQUAL(thrust::reduce(thrust::tbb::par.on(arena), h_input.begin(), h_input.end()),
+                 thrust::reduce(h_input.begin(), h_input.end()));
+
+    thrust::host_vector<T> h_result(n);
+    thrust::host_vector<T> h_reference(n);
+
+    thrust::inclusive_scan(thrust::tbb::par.on(arena), h_input.begin(), h_input.end(), h_result.begin());
+    thrust::inclusive_scan(h_input.begin(), h_input.end(), h_reference.begin());
+
+    ASSERT_EQUAL(h_result, h_reference);
+
+    h_result    = h_input;
+    h_reference = h_input;
+
+    thrust::stable_sort(thrust::tbb::par.on(arena), h_result.begin(), h_result.end());
+    thrust::stable_sort(h_reference.begin(), h_reference.end());
+
+    ASSERT_EQUAL(h_result, h_reference);
+  }
+};
+VariableUnitTest<TestTbbArena, IntegralTypes> TestTbbArenaInstance;
+
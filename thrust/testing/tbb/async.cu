@@ -0,0 +1,173 @@
+#include <thrust/detail/config.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#include <unittest/unittest.h>
+
+#include <thrust/async/for_each.h>
+#include <thrust/async/reduce.h>
+#include <thrust/async/sort.h>
+#include <thrust/async/transform.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/system/tbb/execution_policy.h>
+#include <thrust/system/tbb/future.h>
+
+#include <tbb/task_arena.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+struct record_thread
+{
+  std::thread::id *id;
+
+  record_thread(std::thread::id *id) : id(id) {}
+
+  void operator()(int) const
+  {
+    *id = std::this_thread::get_id();
+  }
+};
+
+
+struct negate_or_throw
+{
+  int operator()(int x) const
+  {
+    if(x < 0)
+    {
+      throw std::runtime_error("negative input");
+    }
+
+    return -x;
+  }
+};
+
+
+template<typename T>
+struct TestTbbAsyncReduce
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+    thrust::tbb::future<T> f0 = thrust::async::reduce(thrust::tbb::par, h_input.begin(), h_input.end());
+
+    ASSERT_EQUAL(f0.get(), thrust::reduce(h_input.begin(), h_input.end()));
+  }
+};
+VariableUnitTest<TestTbbAsyncReduce, IntegralTypes> TestTbbAsyncReduceInstance;
+
+
+void TestTbbAsyncRunsOffTheCallingThread(void)
+{
+  thrust::host_vector<int> h_input(1);
+
+  std::thread::id id = std::this_thread::get_id();
+
+  thrust::tbb::event e0 = thrust::async::for_each(thrust::tbb::par, h_input.begin(), h_input.end(), record_thread(&id));
+  e0.wait();
+
+  ASSERT_EQUAL(id != std::this_thread::get_id(), true);
+}
+DECLARE_UNITTEST(TestTbbAsyncRunsOffTheCallingThread);
+
+
+template<typename T>
+struct TestTbbAsyncAfter
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+    thrust::host_vector<T> h_result(n);
+
+    auto e0 = thrust::async::transform(thrust::tbb::par, h_input.begin(), h_input.end(), h_result.begin(), thrust::negate<T>());
+    auto e1 = thrust::async::stable_sort(thrust::tbb::par.after(e0), h_result.begin(), h_result.end(), thrust::less<T>());
+    auto f2 = thrust::async::reduce(thrust::tbb::par.after(e1), h_result.begin(), h_result.end());
+
+    // the dependencies were consumed by the policies
+    ASSERT_EQUAL(e0.valid(), false);
+    ASSERT_EQUAL(e1.valid(), false);
+
+    const T sum = f2.get();
+
+    thrust::host_vector<T> h_reference(n);
+    thrust::transform(h_input.begin(), h_input.end(), h_reference.begin(), thrust::negate<T>());
+    thrust::stable_sort(h_reference.begin(), h_reference.end());
+
+    ASSERT_EQUAL(h_result, h_reference);
+    ASSERT_EQUAL(sum, thrust::reduce(h_reference.begin(), h_reference.end()));
+  }
+};
+VariableUnitTest<TestTbbAsyncAfter, IntegralTypes> TestTbbAsyncAfterInstance;
+
+
+struct record_concurrency
+{
+  std::atomic<int> *concurrency;
+
+  record_concurrency(std::atomic<int> *concurrency) : concurrency(concurrency) {}
+
+  void operator()(int) const
+  {
+    concurrency->store(::tbb::this_task_arena::max_concurrency());
+  }
+};
+
+
+void TestTbbAsyncRunsInArena(void)
+{
+  ::tbb::task_arena arena(2);
+
+  thrust::host_vector<int> h_input(1);
+
+  std::atomic<int> concurrency(0);
+
+  auto e0 = thrust::async::for_each(thrust::tbb::par.on(arena), h_input.begin(), h_input.end(), record_concurrency(&concurrency));
+  e0.wait();
+
+  ASSERT_EQUAL(concurrency.load(), 2);
+}
+DECLARE_UNITTEST(TestTbbAsyncRunsInArena);
+
+
+void TestTbbAsyncWhenAll(void)
+{
+  thrust::host_vector<int> h_input0 = unittest::random_integers<int>(10000);
+  thrust::host_vector<int> h_input1 = unittest::random_integers<int>(10000);
+
+  auto e0 = thrust::async::sort(thrust::tbb::par, h_input0.begin(), h_input0.end());
+  auto f1 = thrust::async::reduce(thrust::tbb::par, h_input1.begin(), h_input1.end());
+
+  thrust::tbb::event e2 = thrust::when_all(e0, f1);
+
+  ASSERT_EQUAL(e0.valid(), false);
+  ASSERT_EQUAL(f1.valid(), false);
+
+  e2.wait();
+
+  ASSERT_EQUAL(e2.ready(), true);
+  ASSERT_EQUAL(thrust::is_sorted(h_input0.begin(), h_input0.end()), true);
+}
+DECLARE_UNITTEST(TestTbbAsyncWhenAll);
+
+
+void TestTbbAsyncPropagatesExceptions(void)
+{
+  thrust::host_vector<int> h_input(10, 1);
+  thrust::host_vector<int> h_result(10);
+  h_input[5] = -1;
+
+  auto e0 = thrust::async::transform(thrust::tbb::par, h_input.begin(), h_input.end(), h_result.begin(), negate_or_throw());
+  auto f1 = thrust::async::reduce(thrust::tbb::par.after(e0), h_result.begin(), h_result.end());
+
+  // the reduction depends on the failed transform, so it fails too
+  ASSERT_THROWS(f1.get(), std::runtime_error);
+}
+DECLARE_UNITTEST(TestTbbAsyncPropagatesExceptions);
+
+#endif
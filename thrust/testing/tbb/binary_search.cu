@@ -0,0 +1,94 @@
+#include <unittest/unittest.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/functional.h>
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <limits>
+
+template<typename T>
+void TestTbbVectorizedSearchesWithNeedles(const thrust::host_vector<T> &h_haystack, const thrust::host_vector<T> &h_needles)
+{
+  const size_t m = h_needles.size();
+
+  thrust::host_vector<size_t> h_output(m);
+  thrust::host_vector<size_t> h_reference(m);
+
+  thrust::lower_bound(thrust::tbb::par, h_haystack.begin(), h_haystack.end(), h_needles.begin(), h_needles.end(), h_output.begin());
+  thrust::lower_bound(h_haystack.begin(), h_haystack.end(), h_needles.begin(), h_needles.end(), h_reference.begin());
+
+  ASSERT_EQUAL(h_output, h_reference);
+
+  thrust::upper_bound(thrust::tbb::par, h_haystack.begin(), h_haystack.end(), h_needles.begin(), h_needles.end(), h_output.begin());
+  thrust::upper_bound(h_haystack.begin(), h_haystack.end(), h_needles.begin(), h_needles.end(), h_reference.begin());
+
+  ASSERT_EQUAL(h_output, h_reference);
+
+  thrust::host_vector<bool> h_found(m);
+  thrust::host_vector<bool> h_found_reference(m);
+
+  thrust::binary_search(thrust::tbb::par, h_haystack.begin(), h_haystack.end(), h_needles.begin(), h_needles.end(), h_found.begin());
+  thrust::binary_search(h_haystack.begin(), h_haystack.end(), h_needles.begin(), h_needles.end(), h_found_reference.begin());
+
+  ASSERT_EQUAL(h_found, h_found_reference);
+}
+
+
+template<typename T>
+void TestTbbVectorizedSearchesSortedNeedles(const size_t n)
+{
+  // a haystack with runs of equal elements
+  thrust::host_vector<T> h_haystack = unittest::random_integers<T>(n);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    h_haystack[i] = static_cast<T>(h_haystack[i] / 4 * 4);
+  }
+
+  thrust::sort(h_haystack.begin(), h_haystack.end());
+
+  // sorted needles gallop through the haystack, from below its first
+  // element to past its last
+  thrust::host_vector<T> h_needles = unittest::random_integers<T>(n);
+
+  h_needles.push_back(std::numeric_limits<T>::min());
+  h_needles.push_back(std::numeric_limits<T>::max());
+
+  thrust::sort(h_needles.begin(), h_needles.end());
+
+  TestTbbVectorizedSearchesWithNeedles(h_haystack, h_needles);
+
+  // far fewer needles than elements, which gallop further
+  thrust::host_vector<T> h_sparse_needles;
+
+  for(size_t i = 0; i < h_needles.size(); i += 16)
+  {
+    h_sparse_needles.push_back(h_needles[i]);
+  }
+
+  TestTbbVectorizedSearchesWithNeedles(h_haystack, h_sparse_needles);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestTbbVectorizedSearchesSortedNeedles);
+
+
+template<typename T>
+void TestTbbVectorizedSearchesUnsortedNeedles(const size_t n)
+{
+  thrust::host_vector<T> h_haystack = unittest::random_integers<T>(n);
+
+  thrust::sort(h_haystack.begin(), h_haystack.end());
+
+  // needles in no order, which can't gallop
+  thrust::host_vector<T> h_needles = unittest::random_integers<T>(n / 2 + 1);
+
+  TestTbbVectorizedSearchesWithNeedles(h_haystack, h_needles);
+
+  // needles which ascend and then descend in the middle of a tile, after
+  // which the tile bisects the whole haystack
+  thrust::sort(h_needles.begin(), h_needles.end());
+  thrust::sort(h_needles.begin() + h_needles.size() / 3, h_needles.begin() + 2 * h_needles.size() / 3, thrust::greater<T>());
+
+  TestTbbVectorizedSearchesWithNeedles(h_haystack, h_needles);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestTbbVectorizedSearchesUnsortedNeedles);
@@ -0,0 +1,67 @@
+#include <unittest/unittest.h>
+
+#include <thrust/functional.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+template<typename T>
+void TestTbbScanByKeyWithKeys(const thrust::host_vector<int> &h_keys, const thrust::host_vector<T> &h_vals)
+{
+  const size_t n = h_keys.size();
+
+  thrust::host_vector<T> h_output(n);
+  thrust::host_vector<T> h_reference(n);
+
+  thrust::inclusive_scan_by_key(thrust::tbb::par, h_keys.begin(), h_keys.end(), h_vals.begin(), h_output.begin());
+  thrust::inclusive_scan_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(), h_reference.begin());
+
+  ASSERT_EQUAL(h_output, h_reference);
+
+  // the init restarts every segment
+  thrust::exclusive_scan_by_key(thrust::tbb::par, h_keys.begin(), h_keys.end(), h_vals.begin(), h_output.begin(), T(13));
+  thrust::exclusive_scan_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(), h_reference.begin(), T(13));
+
+  ASSERT_EQUAL(h_output, h_reference);
+
+  // in place over the values
+  h_output = h_vals;
+  thrust::inclusive_scan_by_key(thrust::tbb::par, h_keys.begin(), h_keys.end(), h_output.begin(), h_output.begin(),
+                                thrust::equal_to<int>(), thrust::maximum<T>());
+  thrust::inclusive_scan_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(), h_reference.begin(),
+                                thrust::equal_to<int>(), thrust::maximum<T>());
+
+  ASSERT_EQUAL(h_output, h_reference);
+}
+
+
+template<typename T>
+void TestTbbScanByKey(const size_t n)
+{
+  thrust::host_vector<T>   h_vals = unittest::random_integers<T>(n);
+  thrust::host_vector<int> h_keys(n);
+
+  // short segments, which each tile holds many of
+  for(size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] = static_cast<int>(i / 3);
+  }
+
+  TestTbbScanByKeyWithKeys(h_keys, h_vals);
+
+  // a few long segments, which span several tiles
+  h_keys = unittest::random_integers<int>(n);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] %= 5;
+  }
+
+  thrust::sort(h_keys.begin(), h_keys.end());
+
+  TestTbbScanByKeyWithKeys(h_keys, h_vals);
+
+  // a single segment spanning every tile
+  TestTbbScanByKeyWithKeys(thrust::host_vector<int>(n, 7), h_vals);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestTbbScanByKey);
@@ -0,0 +1,115 @@
+#include <unittest/unittest.h>
+
+#include <thrust/set_operations.h>
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <algorithm>
+
+template<typename T>
+void TestTbbSetOperationsWithInputs(const thrust::host_vector<T> &h_a, const thrust::host_vector<T> &h_b)
+{
+  typedef typename thrust::host_vector<T>::iterator Iterator;
+
+  const size_t m = h_a.size() + h_b.size();
+
+  thrust::host_vector<T> h_result(m);
+  thrust::host_vector<T> h_reference(m);
+
+  Iterator h_end = thrust::set_union(thrust::tbb::par, h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_result.begin());
+  Iterator h_reference_end = std::set_union(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_reference.begin());
+
+  ASSERT_EQUAL(h_end - h_result.begin(), h_reference_end - h_reference.begin());
+  ASSERT_EQUAL(h_result, h_reference);
+
+  h_end = thrust::set_intersection(thrust::tbb::par, h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_result.begin());
+  h_reference_end = std::set_intersection(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_reference.begin());
+
+  ASSERT_EQUAL(h_end - h_result.begin(), h_reference_end - h_reference.begin());
+  ASSERT_EQUAL(h_result, h_reference);
+
+  h_end = thrust::set_difference(thrust::tbb::par, h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_result.begin());
+  h_reference_end = std::set_difference(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_reference.begin());
+
+  ASSERT_EQUAL(h_end - h_result.begin(), h_reference_end - h_reference.begin());
+  ASSERT_EQUAL(h_result, h_reference);
+
+  h_end = thrust::set_symmetric_difference(thrust::tbb::par, h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_result.begin());
+  h_reference_end = std::set_symmetric_difference(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_reference.begin());
+
+  ASSERT_EQUAL(h_end - h_result.begin(), h_reference_end - h_reference.begin());
+  ASSERT_EQUAL(h_result, h_reference);
+
+  // the values show which input each key was taken from
+  thrust::host_vector<int> h_a_vals(h_a.size(), 1);
+  thrust::host_vector<int> h_b_vals(h_b.size(), 2);
+  thrust::host_vector<int> h_vals_result(m);
+  thrust::host_vector<int> h_vals_reference(m);
+
+  thrust::set_union_by_key(thrust::tbb::par,
+                           h_a.begin(), h_a.end(), h_b.begin(), h_b.end(),
+                           h_a_vals.begin(), h_b_vals.begin(),
+                           h_result.begin(), h_vals_result.begin());
+  thrust::set_union_by_key(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(),
+                           h_a_vals.begin(), h_b_vals.begin(),
+                           h_reference.begin(), h_vals_reference.begin());
+
+  ASSERT_EQUAL(h_result, h_reference);
+  ASSERT_EQUAL(h_vals_result, h_vals_reference);
+
+  thrust::set_symmetric_difference_by_key(thrust::tbb::par,
+                                          h_a.begin(), h_a.end(), h_b.begin(), h_b.end(),
+                                          h_a_vals.begin(), h_b_vals.begin(),
+                                          h_result.begin(), h_vals_result.begin());
+  thrust::set_symmetric_difference_by_key(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(),
+                                          h_a_vals.begin(), h_b_vals.begin(),
+                                          h_reference.begin(), h_vals_reference.begin());
+
+  ASSERT_EQUAL(h_result, h_reference);
+  ASSERT_EQUAL(h_vals_result, h_vals_reference);
+}
+
+
+template<typename T>
+void TestTbbSetOperations(const size_t n)
+{
+  thrust::host_vector<T> h_a = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_b = unittest::random_integers<T>(n / 3 + 1);
+
+  thrust::sort(h_a.begin(), h_a.end());
+  thrust::sort(h_b.begin(), h_b.end());
+
+  TestTbbSetOperationsWithInputs(h_a, h_b);
+  TestTbbSetOperationsWithInputs(h_b, h_a);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestTbbSetOperations);
+
+
+template<typename T>
+void TestTbbSetOperationsEquivalentRuns(const size_t n)
+{
+  // few distinct keys, so that the runs of equivalent keys are longer than
+  // the tiles and the cuts have to move back to their start
+  thrust::host_vector<T> h_a = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_b = unittest::random_integers<T>(n / 2 + 1);
+
+  for(size_t i = 0; i < h_a.size(); ++i)
+  {
+    h_a[i] = static_cast<T>(h_a[i] % 4);
+  }
+
+  for(size_t i = 0; i < h_b.size(); ++i)
+  {
+    h_b[i] = static_cast<T>(h_b[i] % 4);
+  }
+
+  thrust::sort(h_a.begin(), h_a.end());
+  thrust::sort(h_b.begin(), h_b.end());
+
+  TestTbbSetOperationsWithInputs(h_a, h_b);
+  TestTbbSetOperationsWithInputs(h_b, h_a);
+
+  // a single run spanning every tile
+  TestTbbSetOperationsWithInputs(thrust::host_vector<T>(n, T(1)), h_b);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestTbbSetOperationsEquivalentRuns);
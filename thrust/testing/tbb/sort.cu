@@ -0,0 +1,69 @@
+#include <unittest/unittest.h>
+
+#include <thrust/functional.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <tbb/task_arena.h>
+
+// orders keys by their low bits only, so that many keys are equivalent and
+// the keys aren't radix sorted
+template<typename T>
+struct less_mod
+{
+  T modulus;
+
+  less_mod(T modulus) : modulus(modulus) {}
+
+  bool operator()(const T &lhs, const T &rhs) const
+  {
+    return (lhs % modulus) < (rhs % modulus);
+  }
+};
+
+
+template<typename T>
+void TestTbbSampleSortWithModulus(T modulus)
+{
+  ::tbb::task_arena arena(4);
+
+  // enough keys to be sampled into buckets
+  const size_t n = (1 << 21) + 17;
+
+  thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+  thrust::host_vector<int> h_values(n);
+  thrust::sequence(h_values.begin(), h_values.end());
+
+  thrust::host_vector<T>   h_keys_reference   = h_keys;
+  thrust::host_vector<int> h_values_reference = h_values;
+
+  thrust::stable_sort_by_key(thrust::seq, h_keys_reference.begin(), h_keys_reference.end(), h_values_reference.begin(), less_mod<T>(modulus));
+
+  thrust::host_vector<T> h_result = h_keys;
+
+  thrust::stable_sort(thrust::tbb::par.on(arena), h_result.begin(), h_result.end(), less_mod<T>(modulus));
+
+  ASSERT_EQUAL(h_result, h_keys_reference);
+
+  // the values show that equivalent keys kept their order
+  thrust::stable_sort_by_key(thrust::tbb::par.on(arena), h_keys.begin(), h_keys.end(), h_values.begin(), less_mod<T>(modulus));
+
+  ASSERT_EQUAL(h_keys, h_keys_reference);
+  ASSERT_EQUAL(h_values, h_values_reference);
+}
+
+
+void TestTbbSampleSort(void)
+{
+  TestTbbSampleSortWithModulus<unsigned int>(1u << 30);
+}
+DECLARE_UNITTEST(TestTbbSampleSort);
+
+
+void TestTbbSampleSortFewDistinctKeys(void)
+{
+  // most buckets are full of equivalent keys
+  TestTbbSampleSortWithModulus<unsigned int>(3);
+}
+DECLARE_UNITTEST(TestTbbSampleSortFewDistinctKeys);
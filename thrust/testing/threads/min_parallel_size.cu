@@ -0,0 +1,130 @@
+#include <unittest/unittest.h>
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/system/threads/execution_policy.h>
+
+#include <atomic>
+#include <thread>
+
+struct record_foreign_thread
+{
+  std::thread::id    caller;
+  std::atomic<bool> *foreign;
+
+  record_foreign_thread(std::atomic<bool> *foreign) : caller(std::this_thread::get_id()), foreign(foreign) {}
+
+  int operator()(int x) const
+  {
+    if(std::this_thread::get_id() != caller)
+    {
+      foreign->store(true);
+    }
+
+    return x;
+  }
+};
+
+
+void TestThreadsMinParallelSizeRunsSmallInputsSequentially(void)
+{
+  thrust::host_vector<int> h_input(100000, 1);
+
+  // a handful of elements isn't worth splitting into tiles
+  std::atomic<bool> foreign(false);
+  thrust::transform_reduce(thrust::threads::par, h_input.begin(), h_input.begin() + 10, record_foreign_thread(&foreign), 0, thrust::plus<int>());
+
+  ASSERT_EQUAL(foreign.load(), false);
+
+  // nor is any input smaller than the policy's cutoff, which for_each only
+  // has when the policy sets one
+  thrust::for_each(thrust::threads::par.min_parallel_size(h_input.size() + 1), h_input.begin(), h_input.end(), record_foreign_thread(&foreign));
+
+  ASSERT_EQUAL(foreign.load(), false);
+}
+DECLARE_UNITTEST(TestThreadsMinParallelSizeRunsSmallInputsSequentially);
+
+
+template<typename T>
+struct is_odd
+{
+  _CCCL_HOST_DEVICE bool operator()(const T &x) const
+  {
+    return x % 2 != 0;
+  }
+};
+
+
+template<typename T>
+struct custom_less
+{
+  _CCCL_HOST_DEVICE bool operator()(const T &lhs, const T &rhs) const
+  {
+    return lhs < rhs;
+  }
+};
+
+
+template<typename T>
+struct TestThreadsMinParallelSize
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+    // parallelize whatever can be, however small
+    for(size_t min_size = 1; min_size <= 1024; min_size *= 32)
+    {
+      ASSERT_EQUAL(thrust::reduce(thrust::threads::par.min_parallel_size(min_size), h_input.begin(), h_input.end()),
+                   thrust::reduce(h_input.begin(), h_input.end()));
+
+      thrust::host_vector<T> h_result(n);
+      thrust::host_vector<T> h_reference(n);
+
+      thrust::inclusive_scan(thrust::threads::par.min_parallel_size(min_size), h_input.begin(), h_input.end(), h_result.begin());
+      thrust::inclusive_scan(h_input.begin(), h_input.end(), h_reference.begin());
+
+      ASSERT_EQUAL(h_result, h_reference);
+
+      thrust::exclusive_scan(thrust::threads::par.min_parallel_size(min_size), h_input.begin(), h_input.end(), h_result.begin(), T(13));
+      thrust::exclusive_scan(h_input.begin(), h_input.end(), h_reference.begin(), T(13));
+
+      ASSERT_EQUAL(h_result, h_reference);
+
+      const size_t num_odd = thrust::copy_if(thrust::threads::par.min_parallel_size(min_size), h_input.begin(), h_input.end(), h_result.begin(), is_odd<T>()) - h_result.begin();
+
+      ASSERT_EQUAL(num_odd, size_t(thrust::copy_if(h_input.begin(), h_input.end(), h_reference.begin(), is_odd<T>()) - h_reference.begin()));
+      ASSERT_EQUAL(h_result, h_reference);
+
+      h_result    = h_input;
+      h_reference = h_input;
+
+      thrust::stable_sort(thrust::threads::par.min_parallel_size(min_size), h_result.begin(), h_result.end());
+      thrust::stable_sort(h_reference.begin(), h_reference.end());
+
+      ASSERT_EQUAL(h_result, h_reference);
+
+      // a comparison other than less or greater is merge sorted
+      h_result = h_input;
+
+      thrust::stable_sort(thrust::threads::par.min_parallel_size(min_size), h_result.begin(), h_result.end(), custom_less<T>());
+
+      ASSERT_EQUAL(h_result, h_reference);
+
+      thrust::host_vector<T> h_merged(2 * n);
+      thrust::host_vector<T> h_merged_reference(2 * n);
+
+      thrust::merge(thrust::threads::par.min_parallel_size(min_size), h_result.begin(), h_result.end(), h_reference.begin(), h_reference.end(), h_merged.begin());
+      thrust::merge(h_result.begin(), h_result.end(), h_reference.begin(), h_reference.end(), h_merged_reference.begin());
+
+      ASSERT_EQUAL(h_merged, h_merged_reference);
+    }
+  }
+};
+VariableUnitTest<TestThreadsMinParallelSize, IntegralTypes> TestThreadsMinParallelSizeInstance;
@@ -0,0 +1,119 @@
+#include <unittest/unittest.h>
+
+#include <thrust/for_each.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/system/threads/execution_policy.h>
+
+#include <atomic>
+#include <stdexcept>
+
+struct nested_reduce
+{
+  const int *data;
+  int n;
+  int *results;
+
+  nested_reduce(const int *data, int n, int *results) : data(data), n(n), results(results) {}
+
+  void operator()(int i) const
+  {
+    // a call made from inside a task runs on the calling thread
+    results[i] = thrust::reduce(thrust::threads::par, data, data + n);
+  }
+};
+
+
+void TestThreadsNestedCalls(void)
+{
+  thrust::host_vector<int> h_data(10000, 1);
+  thrust::host_vector<int> h_results(100, 0);
+
+  thrust::for_each(thrust::threads::par,
+                   thrust::counting_iterator<int>(0),
+                   thrust::counting_iterator<int>(100),
+                   nested_reduce(thrust::raw_pointer_cast(h_data.data()),
+                                 static_cast<int>(h_data.size()),
+                                 thrust::raw_pointer_cast(h_results.data())));
+
+  ASSERT_EQUAL(h_results, thrust::host_vector<int>(100, 10000));
+}
+DECLARE_UNITTEST(TestThreadsNestedCalls);
+
+
+struct throw_at
+{
+  int victim;
+  std::atomic<int> *visited;
+
+  throw_at(int victim, std::atomic<int> *visited) : victim(victim), visited(visited) {}
+
+  void operator()(int i) const
+  {
+    ++*visited;
+
+    if(i == victim)
+    {
+      throw std::runtime_error("throw_at");
+    }
+  }
+};
+
+
+void TestThreadsExceptionPropagates(void)
+{
+  std::atomic<int> visited(0);
+
+  bool caught = false;
+
+  try
+  {
+    thrust::for_each(thrust::threads::par,
+                     thrust::counting_iterator<int>(0),
+                     thrust::counting_iterator<int>(100000),
+                     throw_at(5000, &visited));
+  }
+  catch(std::runtime_error &)
+  {
+    caught = true;
+  }
+
+  ASSERT_EQUAL(caught, true);
+  ASSERT_EQUAL(visited.load() <= 100000, true);
+
+  // the pool is still usable afterwards
+  thrust::host_vector<int> h_data(100000, 1);
+  ASSERT_EQUAL(thrust::reduce(thrust::threads::par, h_data.begin(), h_data.end()), 100000);
+}
+DECLARE_UNITTEST(TestThreadsExceptionPropagates);
+
+
+template<typename T>
+struct TestThreadsAlgorithms
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+
+    ASSERT_EQUAL(thrust::reduce(thrust::threads::par, h_input.begin(), h_input.end()),
+                 thrust::reduce(h_input.begin(), h_input.end()));
+
+    thrust::host_vector<T> h_result(n);
+    thrust::host_vector<T> h_reference(n);
+
+    thrust::inclusive_scan(thrust::threads::par, h_input.begin(), h_input.end(), h_result.begin());
+    thrust::inclusive_scan(h_input.begin(), h_input.end(), h_reference.begin());
+
+    ASSERT_EQUAL(h_result, h_reference);
+
+    h_result    = h_input;
+    h_reference = h_input;
+
+    thrust::stable_sort(thrust::threads::par, h_result.begin(), h_result.end());
+    thrust::stable_sort(h_reference.begin(), h_reference.end());
+
+    ASSERT_EQUAL(h_result, h_reference);
+  }
+};
+VariableUnitTest<TestThreadsAlgorithms, IntegralTypes> TestThreadsAlgorithmsInstance;
@@ -87,12 +87,12 @@ set(thrust_libcudacxx_version "${Thrust_VERSION}")
 
 # Advertise system options:
 set(THRUST_HOST_SYSTEM_OPTIONS
-  CPP OMP TBB
+  CPP OMP TBB THREADS
   CACHE INTERNAL "Valid Thrust host systems."
   FORCE
 )
 set(THRUST_DEVICE_SYSTEM_OPTIONS
-  CUDA CPP OMP TBB
+  CUDA CPP OMP TBB THREADS
   CACHE INTERNAL "Valid Thrust device systems"
   FORCE
 )
@@ -268,6 +268,11 @@ function(thrust_is_omp_system_found var_name)
   set(${var_name} ${${var_name}} PARENT_SCOPE)
 endfunction()
 
+function(thrust_is_threads_system_found var_name)
+  thrust_is_system_found(THREADS ${var_name})
+  set(${var_name} ${${var_name}} PARENT_SCOPE)
+endfunction()
+
 # Since components are loaded lazily, this will refresh the
 # THRUST_${component}_FOUND flags in the current scope.
 # Alternatively, check system states individually using the
@@ -278,6 +283,7 @@ macro(thrust_update_system_found_flags)
   thrust_is_system_found(CUDA THRUST_CUDA_FOUND)
   thrust_is_system_found(TBB  THRUST_TBB_FOUND)
   thrust_is_system_found(OMP  THRUST_OMP_FOUND)
+  thrust_is_system_found(THREADS THRUST_THREADS_FOUND)
 endmacro()
 
 function(thrust_debug msg)
@@ -365,6 +371,9 @@ function(thrust_debug_internal_targets)
   _thrust_debug_backend_targets(TBB "${THRUST_TBB_VERSION}")
   thrust_debug_target(TBB::tbb "${THRUST_TBB_VERSION}")
 
+  _thrust_debug_backend_targets(THREADS "Thrust ${THRUST_VERSION}")
+  thrust_debug_target(Threads::Threads "")
+
   _thrust_debug_backend_targets(CUDA "CUB ${THRUST_CUB_VERSION}")
   thrust_debug_target(CUB::CUB "${THRUST_CUB_VERSION}")
   thrust_debug_target(libcudacxx::libcudacxx "${THRUST_libcudacxx_VERSION}")
@@ -643,6 +652,26 @@ macro(_thrust_find_OMP required)
   endif()
 endmacro()
 
+# The THREADS backend only needs the platform's thread library.
+macro(_thrust_find_THREADS required)
+  if (NOT TARGET Thrust::THREADS)
+    thrust_debug("Searching for Threads ${required}" internal)
+    find_package(Threads
+      ${_THRUST_QUIET_FLAG}
+      ${required}
+    )
+
+    if (TARGET Threads::Threads)
+      _thrust_declare_interface_alias(Thrust::THREADS _Thrust_THREADS)
+      target_link_libraries(_Thrust_THREADS INTERFACE Thrust::Thrust Threads::Threads)
+      thrust_debug_target(Thrust::THREADS "Thrust ${THRUST_VERSION}" internal)
+      _thrust_setup_system(THREADS)
+    else()
+      thrust_debug("Threads::Threads not found!" internal)
+    endif()
+  endif()
+endmacro()
+
 # This must be a macro instead of a function to ensure that backends passed to
 # find_package(Thrust COMPONENTS [...]) have their full configuration loaded
 # into the current scope. This provides at least some remedy for CMake issue
@@ -659,6 +688,8 @@ macro(_thrust_find_backend backend required)
     _thrust_find_TBB("${required}")
   elseif ("${backend}" STREQUAL "OMP")
     _thrust_find_OMP("${required}")
+  elseif ("${backend}" STREQUAL "THREADS")
+    _thrust_find_THREADS("${required}")
   else()
     message(FATAL_ERROR "_thrust_find_backend: Invalid system: ${backend}")
   endif()
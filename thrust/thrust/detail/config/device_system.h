@@ -31,6 +31,7 @@
 #define THRUST_DEVICE_SYSTEM_OMP     2
 #define THRUST_DEVICE_SYSTEM_TBB     3
 #define THRUST_DEVICE_SYSTEM_CPP     4
+#define THRUST_DEVICE_SYSTEM_THREADS 5
 
 #ifndef THRUST_DEVICE_SYSTEM
 #define THRUST_DEVICE_SYSTEM THRUST_DEVICE_SYSTEM_CUDA
@@ -48,6 +49,8 @@
 #define __THRUST_DEVICE_SYSTEM_NAMESPACE tbb
 #elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CPP
 #define __THRUST_DEVICE_SYSTEM_NAMESPACE cpp
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_THREADS
+#define __THRUST_DEVICE_SYSTEM_NAMESPACE threads
 #endif
 
 #define __THRUST_DEVICE_SYSTEM_ROOT thrust/system/__THRUST_DEVICE_SYSTEM_NAMESPACE
@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2018 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file host_tls_pool.h
+ *  \brief A memory resource, and an allocator over it, which serve host memory from a pool local to the calling thread.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp11_required.h>
+
+#if _CCCL_STD_VER >= 2011
+
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/tls_pool.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_management Memory Management
+ *  \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_resources
+ *  \{
+ */
+
+/*! A memory resource which serves each allocation from the \p tls_pool over \p new_delete_resource of the thread
+ *  which asks for it. Unlike a resource holding a single pool, it may be used from several threads at once, but memory
+ *  must be deallocated on the thread which allocated it.
+ */
+class host_tls_pool_resource final : public memory_resource<>
+{
+public:
+    void * do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        return pool().allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        pool().deallocate(p, bytes, alignment);
+    }
+
+private:
+    static unsynchronized_pool_resource<new_delete_resource> & pool()
+    {
+        return tls_pool(get_global_resource<new_delete_resource>());
+    }
+};
+
+/*! Returns an allocator over the global \p host_tls_pool_resource. Passed to a host execution policy, it lets the
+ *  temporary buffers of the policy's algorithms reuse blocks cached by earlier calls on the same thread, rather than
+ *  come from the system allocator every time:
+ *
+ *  \code
+ *  thrust::reduce_by_key(thrust::omp::par(thrust::mr::host_tls_caching_allocator()), ...);
+ *  \endcode
+ *
+ *  The algorithms always return their temporary storage on the thread which allocated it, so such a policy may be used
+ *  from any thread. Storage obtained through \p thrust::get_temporary_buffer must be returned on the allocating
+ *  thread as well.
+ */
+inline allocator<char, host_tls_pool_resource> host_tls_caching_allocator()
+{
+    return { get_global_resource<host_tls_pool_resource>() };
+}
+
+/*! \}
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
+
+#endif // _CCCL_STD_VER >= 2011
+
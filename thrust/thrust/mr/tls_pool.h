@@ -50,7 +50,7 @@ namespace mr
  *  \tparam Upstream the template argument to the pool template
  *  \param upstream the argument to the constructor, if invoked
  */
-template<typename Upstream, typename Bookkeeper>
+template<typename Upstream, typename Bookkeeper = void>
 _CCCL_HOST
 thrust::mr::unsynchronized_pool_resource<Upstream> & tls_pool(Upstream * upstream = NULL)
 {
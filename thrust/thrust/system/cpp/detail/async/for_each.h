@@ -0,0 +1,71 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#include <thrust/for_each.h>
+#include <thrust/system/cpp/detail/async/launch.h>
+#include <thrust/system/cpp/detail/execution_policy.h>
+#include <thrust/system/cpp/future.h>
+#include <thrust/detail/type_deduction.h>
+#include <thrust/type_traits/remove_cvref.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system { namespace cpp { namespace detail
+{
+
+// ADL entry point.
+template <
+  typename DerivedPolicy
+, typename ForwardIt, typename Sentinel, typename UnaryFunction
+>
+unique_eager_event async_for_each(
+  execution_policy<DerivedPolicy>& policy
+, ForwardIt                        first
+, Sentinel                         last
+, UnaryFunction&&                  func
+)
+{
+  return launch_async_event(
+    policy
+  , [first, last, f = remove_cvref_t<UnaryFunction>(THRUST_FWD(func))]
+    (DerivedPolicy& exec)
+    {
+      thrust::for_each(exec, first, last, f);
+    }
+  );
+}
+
+}}} // namespace system::cpp::detail
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
+
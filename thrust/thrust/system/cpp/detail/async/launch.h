@@ -0,0 +1,301 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file launch.h
+ *  \brief Runs the asynchronous algorithms of the host systems once their
+ *         dependencies are done.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#include <thrust/detail/execute_with_dependencies.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/system/cpp/detail/execution_policy.h>
+#include <thrust/system/cpp/future.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system { namespace cpp { namespace detail
+{
+
+// The threads which run the asynchronous algorithms of the host systems, one
+// job each at a time, in the order they were enqueued. A job which waited on
+// another would tie up its thread, so jobs are only enqueued once their
+// dependencies are done.
+class async_thread_pool
+{
+public:
+  // the pool is started on first use and joined at exit, once the jobs
+  // enqueued by then are done
+  static async_thread_pool &instance()
+  {
+    static async_thread_pool pool;
+    return pool;
+  }
+
+  void enqueue(std::function<void()> job)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      jobs.push_back(std::move(job));
+    }
+
+    wake_up.notify_one();
+  }
+
+  // the number of jobs which may run at the same time
+  std::size_t size() const
+  {
+    return workers.size();
+  }
+
+  ~async_thread_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+
+    wake_up.notify_all();
+
+    for(std::size_t i = 0; i < workers.size(); ++i)
+    {
+      workers[i].join();
+    }
+  }
+
+private:
+  std::vector<std::thread> workers;
+
+  // guards everything below
+  std::mutex                        mutex;
+  std::condition_variable           wake_up;
+  std::deque<std::function<void()>> jobs;
+  bool                              stopping;
+
+  async_thread_pool()
+    : stopping(false)
+  {
+    const std::size_t p = thrust::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    workers.reserve(p);
+    for(std::size_t i = 0; i < p; ++i)
+    {
+      workers.push_back(std::thread(&async_thread_pool::worker_loop, this));
+    }
+  }
+
+  async_thread_pool(const async_thread_pool &);
+  async_thread_pool &operator=(const async_thread_pool &);
+
+  void worker_loop()
+  {
+    for(;;)
+    {
+      std::function<void()> job;
+
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        wake_up.wait(lock, [this]{ return stopping || !jobs.empty(); });
+
+        if(jobs.empty())
+          return;
+
+        job = std::move(jobs.front());
+        jobs.pop_front();
+      }
+
+      job();
+    }
+  }
+};
+
+
+// Runs job() asynchronously on behalf of exec. A host system whose algorithms
+// have somewhere better to run, e.g. a TBB arena, overloads this for its own
+// execution_policy.
+template<typename DerivedPolicy, typename Job>
+void enqueue_async(execution_policy<DerivedPolicy> &, Job job)
+{
+  async_thread_pool::instance().enqueue(std::move(job));
+}
+
+
+namespace async_detail
+{
+
+// stores what an operation computed in the state of its event or future
+template<typename Function, typename Policy>
+void compute(async_signal &, Function &f, Policy &exec)
+{
+  f(exec);
+}
+
+template<typename T, typename Function, typename Policy>
+void compute(async_value<T> &state, Function &f, Policy &exec)
+{
+  state.content.reset(new T(f(exec)));
+}
+
+
+// An operation waiting to run, with the policy it was launched on and the
+// states of the events and futures it depends on.
+template<typename State, typename DerivedPolicy, typename Function>
+struct async_task
+{
+  DerivedPolicy                              exec;
+  Function                                   f;
+  std::shared_ptr<State>                     state;
+  std::vector<std::shared_ptr<async_signal>> dependencies;
+
+  async_task(DerivedPolicy &&exec_,
+             Function f_,
+             std::shared_ptr<State> state_,
+             std::vector<std::shared_ptr<async_signal>> dependencies_)
+    : exec(std::move(exec_)), f(std::move(f_)), state(std::move(state_)), dependencies(std::move(dependencies_))
+  {}
+
+  // a failed dependency fails the operation without running it
+  void run()
+  {
+    std::exception_ptr error = first_error(dependencies);
+
+    if(!error)
+    {
+      try
+      {
+        compute(*state, f, exec);
+      }
+      catch(...)
+      {
+        error = std::current_exception();
+      }
+    }
+
+    // let go of the dependencies' content before anyone who waits on us wakes
+    dependencies.clear();
+
+    state->finish(error);
+  }
+};
+
+
+// Runs f(exec) asynchronously once the dependencies are done, where exec is
+// the policy with its own dependencies taken out, and stores the result in
+// state.
+template<typename State, typename DerivedPolicy, typename Function, typename... Dependencies>
+void launch(execution_policy<DerivedPolicy> &exec,
+            std::tuple<Dependencies...> &&deps,
+            Function f,
+            std::shared_ptr<State> state)
+{
+  typedef async_task<State,DerivedPolicy,Function> task_type;
+
+  std::vector<std::shared_ptr<async_signal>> signals = acquire_signals(deps);
+
+  std::shared_ptr<task_type> task =
+    std::make_shared<task_type>(std::move(thrust::detail::derived_cast(exec)),
+                                std::move(f),
+                                std::move(state),
+                                signals);
+
+  when_all_finished(signals, [task]
+  {
+    enqueue_async(task->exec, [task]{ task->run(); });
+  });
+}
+
+} // namespace async_detail
+
+
+// Launches f(exec) asynchronously after exec's dependencies, along with
+// extra_deps, and returns an event which is ready once it's done.
+template<typename DerivedPolicy, typename Function, typename... Dependencies>
+unique_eager_event
+launch_async_event(execution_policy<DerivedPolicy> &exec,
+                   std::tuple<Dependencies...> &&extra_deps,
+                   Function f)
+{
+  std::shared_ptr<async_signal> state = std::make_shared<async_signal>();
+
+  async_detail::launch(exec,
+                       std::tuple_cat(thrust::detail::extract_dependencies(
+                                        std::move(thrust::detail::derived_cast(exec))),
+                                      std::move(extra_deps)),
+                       std::move(f),
+                       state);
+
+  return async_access::make_event(std::move(state));
+}
+
+
+template<typename DerivedPolicy, typename Function>
+unique_eager_event
+launch_async_event(execution_policy<DerivedPolicy> &exec, Function f)
+{
+  return launch_async_event(exec, std::tuple<>(), std::move(f));
+}
+
+
+// Launches f(exec) asynchronously after exec's dependencies, and returns a
+// future of the T it returns.
+template<typename T, typename DerivedPolicy, typename Function>
+unique_eager_future<T>
+launch_async_future(execution_policy<DerivedPolicy> &exec, Function f)
+{
+  std::shared_ptr<async_value<T>> state = std::make_shared<async_value<T>>();
+
+  async_detail::launch(exec,
+                       thrust::detail::extract_dependencies(
+                         std::move(thrust::detail::derived_cast(exec))),
+                       std::move(f),
+                       state);
+
+  return async_access::make_future<T>(std::move(state));
+}
+
+}}} // namespace system::cpp::detail
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
+
@@ -0,0 +1,487 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#include <thrust/system/cpp/future.h>
+#include <thrust/detail/event_error.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/type_deduction.h>
+#include <thrust/type_traits/integer_sequence.h>
+#include <thrust/type_traits/remove_cvref.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system { namespace cpp
+{
+
+namespace detail
+{
+
+// The state an asynchronous operation shares with the event or future which
+// waits for it. The thread which runs the operation finishes it once, with the
+// exception the operation threw if it failed, and then runs the continuations
+// registered before that.
+struct async_signal
+{
+  async_signal() : done(false) {}
+
+  virtual ~async_signal() {}
+
+  bool ready() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return done;
+  }
+
+  // blocks until the operation has finished
+  void wait() const
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this]{ return done; });
+  }
+
+  // the exception the operation threw, or null; only meaningful once ready
+  std::exception_ptr error() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return exception;
+  }
+
+  // runs f() once the operation has finished: right here if it already has,
+  // or else on the thread which finishes it
+  void then(std::function<void()> f)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      if(!done)
+      {
+        continuations.push_back(std::move(f));
+        return;
+      }
+    }
+
+    f();
+  }
+
+  void finish(std::exception_ptr e = std::exception_ptr())
+  {
+    std::vector<std::function<void()>> pending;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      exception = e;
+      done      = true;
+      pending.swap(continuations);
+    }
+
+    finished.notify_all();
+
+    for(std::size_t i = 0; i < pending.size(); ++i)
+    {
+      pending[i]();
+    }
+  }
+
+private:
+  mutable std::mutex                 mutex;
+  mutable std::condition_variable    finished;
+  bool                               done;
+  std::exception_ptr                 exception;
+  std::vector<std::function<void()>> continuations;
+};
+
+// the state of an operation which produces a T, set before it finishes
+template <typename T>
+struct async_value : async_signal
+{
+  std::unique_ptr<T> content;
+};
+
+// grants the launching code access to the state of events and futures
+struct async_access;
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////
+
+struct unique_eager_event final
+{
+private:
+  std::shared_ptr<detail::async_signal> async_signal_;
+
+  _CCCL_HOST
+  explicit unique_eager_event(std::shared_ptr<detail::async_signal> async_signal)
+    : async_signal_(std::move(async_signal))
+  {}
+
+public:
+  _CCCL_HOST
+  unique_eager_event() : async_signal_() {}
+
+  unique_eager_event(unique_eager_event&&) = default;
+  unique_eager_event(unique_eager_event const&) = delete;
+  unique_eager_event& operator=(unique_eager_event&&) = default;
+  unique_eager_event& operator=(unique_eager_event const&) = delete;
+
+  // Any `unique_eager_future<T>` can be explicitly converted to a
+  // `unique_eager_event`.
+  template <typename U>
+  _CCCL_HOST
+  explicit unique_eager_event(unique_eager_future<U>&& other)
+    : async_signal_(std::move(other.async_signal_))
+  {}
+
+  // The operation may still use the memory it was given, so wait for it.
+  _CCCL_HOST
+  ~unique_eager_event()
+  {
+    if (valid()) async_signal_->wait();
+  }
+
+  _CCCL_HOST
+  bool valid() const noexcept
+  {
+    return bool(async_signal_);
+  }
+
+  _CCCL_HOST
+  bool ready() const noexcept
+  {
+    return valid() && async_signal_->ready();
+  }
+
+  // Blocks, and rethrows the exception the operation failed with, if any.
+  // Precondition: `true == valid()`.
+  _CCCL_HOST
+  void wait()
+  {
+    if (!valid())
+      throw thrust::event_error(event_errc::no_state);
+
+    async_signal_->wait();
+
+    if (std::exception_ptr e = async_signal_->error())
+      std::rethrow_exception(e);
+  }
+
+  friend struct detail::async_access;
+};
+
+template <typename T>
+struct unique_eager_future final
+{
+  THRUST_STATIC_ASSERT_MSG(
+    (!std::is_same<T, remove_cvref_t<void>>::value)
+  , "`thrust::event` should be used to express valueless futures"
+  );
+
+  using value_type = T;
+
+private:
+  std::shared_ptr<detail::async_value<value_type>> async_signal_;
+
+  _CCCL_HOST
+  explicit unique_eager_future(
+    std::shared_ptr<detail::async_value<value_type>> async_signal
+  )
+    : async_signal_(std::move(async_signal))
+  {}
+
+public:
+  _CCCL_HOST
+  unique_eager_future() : async_signal_() {}
+
+  unique_eager_future(unique_eager_future&&) = default;
+  unique_eager_future(unique_eager_future const&) = delete;
+  unique_eager_future& operator=(unique_eager_future&&) = default;
+  unique_eager_future& operator=(unique_eager_future const&) = delete;
+
+  // The operation may still use the memory it was given, so wait for it.
+  _CCCL_HOST
+  ~unique_eager_future()
+  {
+    if (valid()) async_signal_->wait();
+  }
+
+  _CCCL_HOST
+  bool valid() const noexcept
+  {
+    return bool(async_signal_);
+  }
+
+  _CCCL_HOST
+  bool ready() const noexcept
+  {
+    return valid() && async_signal_->ready();
+  }
+
+  // Blocks, and rethrows the exception the operation failed with, if any.
+  // Precondition: `true == valid()`.
+  _CCCL_HOST
+  void wait()
+  {
+    if (!valid())
+      throw thrust::event_error(event_errc::no_state);
+
+    async_signal_->wait();
+
+    if (std::exception_ptr e = async_signal_->error())
+      std::rethrow_exception(e);
+  }
+
+  // Blocks.
+  // Precondition: `true == valid()`.
+  _CCCL_HOST
+  value_type get()
+  {
+    if (!valid())
+      throw thrust::event_error(event_errc::no_content);
+
+    wait();
+
+    return *async_signal_->content;
+  }
+
+  // Blocks, and leaves the future without a state.
+  // Precondition: `true == valid()`.
+  THRUST_NODISCARD _CCCL_HOST
+  value_type extract()
+  {
+    if (!valid())
+      throw thrust::event_error(event_errc::no_content);
+
+    wait();
+
+    value_type tmp(std::move(*async_signal_->content));
+    async_signal_.reset();
+    return tmp;
+  }
+
+  friend struct unique_eager_event;
+
+  friend struct detail::async_access;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+struct async_access
+{
+  static unique_eager_event make_event(std::shared_ptr<async_signal> s)
+  {
+    return unique_eager_event(std::move(s));
+  }
+
+  template <typename T>
+  static unique_eager_future<T> make_future(std::shared_ptr<async_value<T>> s)
+  {
+    return unique_eager_future<T>(std::move(s));
+  }
+
+  static std::shared_ptr<async_signal> release(unique_eager_event& e)
+  {
+    return std::move(e.async_signal_);
+  }
+
+  template <typename T>
+  static std::shared_ptr<async_signal> release(unique_eager_future<T>& f)
+  {
+    return std::move(f.async_signal_);
+  }
+};
+
+// Takes over the state of a dependency, so that whatever depends on it can
+// wait for it and keep its content alive.
+inline _CCCL_HOST
+void acquire_signal(
+  std::vector<std::shared_ptr<async_signal>>& signals, unique_eager_event& dependency
+)
+{
+  std::shared_ptr<async_signal> s = async_access::release(dependency);
+
+  if (s) signals.push_back(std::move(s));
+}
+
+template <typename X>
+_CCCL_HOST
+void acquire_signal(
+  std::vector<std::shared_ptr<async_signal>>& signals, unique_eager_future<X>& dependency
+)
+{
+  std::shared_ptr<async_signal> s = async_access::release(dependency);
+
+  if (s) signals.push_back(std::move(s));
+}
+
+// A dependency of another system, e.g. a CUDA event, can't notify us when
+// it's done, so wait for it here.
+template <typename Dependency>
+_CCCL_HOST
+void acquire_signal(
+  std::vector<std::shared_ptr<async_signal>>&, Dependency& dependency
+)
+{
+  dependency.wait();
+}
+
+template <typename... Dependencies, std::size_t... Is>
+_CCCL_HOST
+void acquire_signals_impl(
+  std::vector<std::shared_ptr<async_signal>>& signals
+, std::tuple<Dependencies...>& deps, index_sequence<Is...>
+)
+{
+  int dummy[] = {0, (acquire_signal(signals, std::get<Is>(deps)), 0)...};
+  (void) dummy;
+}
+
+template <typename... Dependencies>
+_CCCL_HOST
+std::vector<std::shared_ptr<async_signal>>
+acquire_signals(std::tuple<Dependencies...>& deps)
+{
+  std::vector<std::shared_ptr<async_signal>> signals;
+  signals.reserve(sizeof...(Dependencies));
+
+  acquire_signals_impl(
+    signals, deps, make_index_sequence<sizeof...(Dependencies)>{}
+  );
+
+  return signals;
+}
+
+// the first exception among signals which have all finished, or null
+inline _CCCL_HOST
+std::exception_ptr first_error(
+  std::vector<std::shared_ptr<async_signal>> const& signals
+)
+{
+  for (std::size_t i = 0; i < signals.size(); ++i)
+  {
+    if (std::exception_ptr e = signals[i]->error())
+      return e;
+  }
+
+  return std::exception_ptr();
+}
+
+// Calls f() once every one of signals has finished: right here if they all
+// already have, or else on the thread which finishes the last of them.
+template <typename Function>
+_CCCL_HOST
+void when_all_finished(
+  std::vector<std::shared_ptr<async_signal>> const& signals, Function f
+)
+{
+  struct countdown
+  {
+    std::atomic<std::size_t> pending;
+    Function                 f;
+
+    countdown(std::size_t n, Function f) : pending(n), f(std::move(f)) {}
+
+    void arrive()
+    {
+      if (pending.fetch_sub(1) == 1) f();
+    }
+  };
+
+  // one more arrival than there are signals, so f isn't called until all of
+  // them have been registered with
+  std::shared_ptr<countdown> c =
+    std::make_shared<countdown>(signals.size() + 1, std::move(f));
+
+  for (std::size_t i = 0; i < signals.size(); ++i)
+  {
+    signals[i]->then([c]{ c->arrive(); });
+  }
+
+  c->arrive();
+}
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Consumes the events and futures it's given, and returns an event which is
+// ready once all of them are, with the first exception any of them failed
+// with.
+template <typename... Events>
+_CCCL_HOST
+unique_eager_event when_all(Events&&... evs)
+{
+  auto deps = std::make_tuple(std::move(evs)...);
+
+  std::vector<std::shared_ptr<detail::async_signal>> signals =
+    detail::acquire_signals(deps);
+
+  std::shared_ptr<detail::async_signal> result =
+    std::make_shared<detail::async_signal>();
+
+  detail::when_all_finished(signals, [result, signals]
+  {
+    result->finish(detail::first_error(signals));
+  });
+
+  return detail::async_access::make_event(std::move(result));
+}
+
+// ADL hook for transparent `.after` move support.
+inline _CCCL_HOST
+auto capture_as_dependency(unique_eager_event& dependency)
+THRUST_DECLTYPE_RETURNS(std::move(dependency))
+
+// ADL hook for transparent `.after` move support.
+template <typename X>
+_CCCL_HOST
+auto capture_as_dependency(unique_eager_future<X>& dependency)
+THRUST_DECLTYPE_RETURNS(std::move(dependency))
+
+}} // namespace system::cpp
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
+
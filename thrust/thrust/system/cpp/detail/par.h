@@ -26,6 +26,9 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#if _CCCL_STD_VER >= 2011
+#  include <thrust/detail/dependencies_aware_execution_policy.h>
+#endif
 #include <thrust/system/cpp/detail/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -40,6 +43,10 @@ namespace detail
 struct par_t : thrust::system::cpp::detail::execution_policy<par_t>,
   thrust::detail::allocator_aware_execution_policy<
     thrust::system::cpp::detail::execution_policy>
+#if _CCCL_STD_VER >= 2011
+, thrust::detail::dependencies_aware_execution_policy<
+    thrust::system::cpp::detail::execution_policy>
+#endif
 {
   _CCCL_HOST_DEVICE
   constexpr par_t() : thrust::system::cpp::detail::execution_policy<par_t>() {}
@@ -0,0 +1,90 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file cpp/future.h
+ *  \brief The events and futures of the asynchronous algorithms of the
+ *         Standard C++ system and of the host systems built on it.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#include <thrust/system/cpp/pointer.h>
+#include <thrust/system/cpp/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system { namespace cpp
+{
+
+struct unique_eager_event;
+
+template <typename T>
+struct unique_eager_future;
+
+template <typename... Events>
+_CCCL_HOST
+unique_eager_event when_all(Events&&... evs);
+
+}} // namespace system::cpp
+
+namespace cpp
+{
+
+using thrust::system::cpp::unique_eager_event;
+using event = unique_eager_event;
+
+using thrust::system::cpp::unique_eager_future;
+template <typename T> using future = unique_eager_future<T>;
+
+using thrust::system::cpp::when_all;
+
+} // namespace cpp
+
+// The omp, tbb and threads policies derive from the cpp ones, so these pick
+// the same events and futures for all of them.
+template <typename DerivedPolicy>
+_CCCL_HOST
+thrust::cpp::unique_eager_event
+unique_eager_event_type(
+  thrust::cpp::execution_policy<DerivedPolicy> const&
+) noexcept;
+
+template <typename T, typename DerivedPolicy>
+_CCCL_HOST
+thrust::cpp::unique_eager_future<T>
+unique_eager_future_type(
+  thrust::cpp::execution_policy<DerivedPolicy> const&
+) noexcept;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/system/cpp/detail/future.inl>
+
+#endif // C++14
+
@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/adjacent_difference.h>
 #include <thrust/system/omp/detail/adjacent_difference.h>
 #include <thrust/system/tbb/detail/adjacent_difference.h>
+#include <thrust/system/threads/detail/adjacent_difference.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_ADJACENT_DIFFERENCE_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/adjacent_difference.h>
@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/assign_value.h>
 #include <thrust/system/omp/detail/assign_value.h>
 #include <thrust/system/tbb/detail/assign_value.h>
+#include <thrust/system/threads/detail/assign_value.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_ASSIGN_VALUE_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/assign_value.h>
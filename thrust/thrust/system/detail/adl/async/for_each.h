@@ -32,9 +32,9 @@
 
 //#include <thrust/system/detail/sequential/async/for_each.h>
 
-//#define __THRUST_HOST_SYSTEM_ASYNC_FOR_EACH_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/async/for_each.h>
-//#include __THRUST_HOST_SYSTEM_ASYNC_FOR_EACH_HEADER
-//#undef __THRUST_HOST_SYSTEM_ASYNC_FOR_EACH_HEADER
+#define __THRUST_HOST_SYSTEM_ASYNC_FOR_EACH_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/async/for_each.h>
+#include __THRUST_HOST_SYSTEM_ASYNC_FOR_EACH_HEADER
+#undef __THRUST_HOST_SYSTEM_ASYNC_FOR_EACH_HEADER
 
 #define __THRUST_DEVICE_SYSTEM_ASYNC_FOR_EACH_HEADER <__THRUST_DEVICE_SYSTEM_ROOT/detail/async/for_each.h>
 #include __THRUST_DEVICE_SYSTEM_ASYNC_FOR_EACH_HEADER
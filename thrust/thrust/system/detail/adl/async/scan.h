@@ -32,9 +32,9 @@
 
 //#include <thrust/system/detail/sequential/async/scan.h>
 
-//#define __THRUST_HOST_SYSTEM_ASYNC_SCAN_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/async/scan.h>
-//#include __THRUST_HOST_SYSTEM_ASYNC_SCAN_HEADER
-//#undef __THRUST_HOST_SYSTEM_ASYNC_SCAN_HEADER
+#define __THRUST_HOST_SYSTEM_ASYNC_SCAN_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/async/scan.h>
+#include __THRUST_HOST_SYSTEM_ASYNC_SCAN_HEADER
+#undef __THRUST_HOST_SYSTEM_ASYNC_SCAN_HEADER
 
 #define __THRUST_DEVICE_SYSTEM_ASYNC_SCAN_HEADER <__THRUST_DEVICE_SYSTEM_ROOT/detail/async/scan.h>
 #include __THRUST_DEVICE_SYSTEM_ASYNC_SCAN_HEADER
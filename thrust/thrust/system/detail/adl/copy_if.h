@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/copy_if.h>
 #include <thrust/system/omp/detail/copy_if.h>
 #include <thrust/system/tbb/detail/copy_if.h>
+#include <thrust/system/threads/detail/copy_if.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_COPY_IF_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/copy_if.h>
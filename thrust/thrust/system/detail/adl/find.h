@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/find.h>
 #include <thrust/system/omp/detail/find.h>
 #include <thrust/system/tbb/detail/find.h>
+#include <thrust/system/threads/detail/find.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_FIND_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/find.h>
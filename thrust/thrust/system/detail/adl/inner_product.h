@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/inner_product.h>
 #include <thrust/system/omp/detail/inner_product.h>
 #include <thrust/system/tbb/detail/inner_product.h>
+#include <thrust/system/threads/detail/inner_product.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_INNER_PRODUCT_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/inner_product.h>
@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/malloc_and_free.h>
 #include <thrust/system/omp/detail/malloc_and_free.h>
 #include <thrust/system/tbb/detail/malloc_and_free.h>
+#include <thrust/system/threads/detail/malloc_and_free.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_MALLOC_AND_FREE_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/malloc_and_free.h>
@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/partition.h>
 #include <thrust/system/omp/detail/partition.h>
 #include <thrust/system/tbb/detail/partition.h>
+#include <thrust/system/threads/detail/partition.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_PARTITION_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/partition.h>
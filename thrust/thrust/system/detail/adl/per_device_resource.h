@@ -37,6 +37,7 @@
 #include <thrust/system/cuda/detail/per_device_resource.h>
 #include <thrust/system/omp/detail/per_device_resource.h>
 #include <thrust/system/tbb/detail/per_device_resource.h>
+#include <thrust/system/threads/detail/per_device_resource.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_PER_DEVICE_RESOURCE_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/per_device_resource.h>
@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/reduce.h>
 #include <thrust/system/omp/detail/reduce.h>
 #include <thrust/system/tbb/detail/reduce.h>
+#include <thrust/system/threads/detail/reduce.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_REDUCE_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/reduce.h>
@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/reverse.h>
 #include <thrust/system/omp/detail/reverse.h>
 #include <thrust/system/tbb/detail/reverse.h>
+#include <thrust/system/threads/detail/reverse.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_REVERSE_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/reverse.h>
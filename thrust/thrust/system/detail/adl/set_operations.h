@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/set_operations.h>
 #include <thrust/system/omp/detail/set_operations.h>
 #include <thrust/system/tbb/detail/set_operations.h>
+#include <thrust/system/threads/detail/set_operations.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_SET_OPERATIONS_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/set_operations.h>
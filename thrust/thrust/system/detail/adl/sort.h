@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/sort.h>
 #include <thrust/system/omp/detail/sort.h>
 #include <thrust/system/tbb/detail/sort.h>
+#include <thrust/system/threads/detail/sort.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_SORT_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/sort.h>
@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/temporary_buffer.h>
 #include <thrust/system/omp/detail/temporary_buffer.h>
 #include <thrust/system/tbb/detail/temporary_buffer.h>
+#include <thrust/system/threads/detail/temporary_buffer.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_TEMPORARY_BUFFER_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/temporary_buffer.h>
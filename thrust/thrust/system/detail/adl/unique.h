@@ -40,6 +40,7 @@
 #include <thrust/system/cuda/detail/unique.h>
 #include <thrust/system/omp/detail/unique.h>
 #include <thrust/system/tbb/detail/unique.h>
+#include <thrust/system/threads/detail/unique.h>
 #endif
 
 #define __THRUST_HOST_SYSTEM_UNIQUE_HEADER <__THRUST_HOST_SYSTEM_ROOT/detail/unique.h>
@@ -34,6 +34,9 @@
 #include <thrust/transform.h>
 #include <thrust/scatter.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/detail/range/tail_flags.h>
 #include <limits>
 
 #include <thrust/detail/internal_functional.h>
@@ -70,6 +73,30 @@ struct reduce_by_key_functor
 };
 
 
+// flags the first key of every segment, comparing each key with its predecessor
+template <typename InputIterator, typename BinaryPredicate, typename FlagType>
+struct reduce_by_key_head_flag_functor
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  BinaryPredicate binary_pred; // this must be the first member for performance reasons
+  InputIterator keys;
+
+  typedef FlagType result_type;
+
+  _CCCL_HOST_DEVICE
+  reduce_by_key_head_flag_functor(InputIterator keys, BinaryPredicate binary_pred)
+    : binary_pred(binary_pred), keys(keys)
+  {}
+
+  _CCCL_HOST_DEVICE _CCCL_FORCEINLINE
+  result_type operator()(const difference_type &i)
+  {
+    return (i == 0 || !binary_pred(keys[i - 1], keys[i]));
+  }
+};
+
+
 } // end namespace detail
 
 
@@ -106,15 +133,16 @@ _CCCL_HOST_DEVICE
 
     InputIterator2 values_last = values_first + n;
 
-    // compute head flags
-    thrust::detail::temporary_array<FlagType,ExecutionPolicy> head_flags(exec, n);
-    thrust::transform(exec, keys_first, keys_last - 1, keys_first + 1, head_flags.begin() + 1, thrust::detail::not2(binary_pred));
-    head_flags[0] = 1;
+    // compute the head and tail flags on the fly rather than storing them
+    typedef thrust::transform_iterator<
+      detail::reduce_by_key_head_flag_functor<InputIterator1, BinaryPredicate, FlagType>,
+      thrust::counting_iterator<difference_type>
+    > head_flags_iterator;
+
+    head_flags_iterator head_flags(thrust::counting_iterator<difference_type>(0),
+                                   detail::reduce_by_key_head_flag_functor<InputIterator1, BinaryPredicate, FlagType>(keys_first, binary_pred));
 
-    // compute tail flags
-    thrust::detail::temporary_array<FlagType,ExecutionPolicy> tail_flags(exec, n); //COPY INSTEAD OF TRANSFORM
-    thrust::transform(exec, keys_first, keys_last - 1, keys_first + 1, tail_flags.begin(), thrust::detail::not2(binary_pred));
-    tail_flags[n-1] = 1;
+    thrust::detail::tail_flags<InputIterator1, BinaryPredicate, FlagType> tail_flags(keys_first, keys_last, binary_pred);
 
     // scan the values by flag
     thrust::detail::temporary_array<ValueType,ExecutionPolicy> scanned_values(exec, n);
@@ -122,8 +150,8 @@ _CCCL_HOST_DEVICE
 
     thrust::inclusive_scan
         (exec,
-         thrust::make_zip_iterator(thrust::make_tuple(values_first,           head_flags.begin())),
-         thrust::make_zip_iterator(thrust::make_tuple(values_last,            head_flags.end())),
+         thrust::make_zip_iterator(thrust::make_tuple(values_first,           head_flags)),
+         thrust::make_zip_iterator(thrust::make_tuple(values_last,            head_flags + n)),
          thrust::make_zip_iterator(thrust::make_tuple(scanned_values.begin(), scanned_tail_flags.begin())),
          detail::reduce_by_key_functor<ValueType, FlagType, BinaryFunction>(binary_op));
 
@@ -133,7 +161,7 @@ _CCCL_HOST_DEVICE
     FlagType N = scanned_tail_flags[n - 1] + 1;
 
     // scatter the keys and accumulated values
-    thrust::scatter_if(exec, keys_first,            keys_last,             scanned_tail_flags.begin(), head_flags.begin(), keys_output);
+    thrust::scatter_if(exec, keys_first,            keys_last,             scanned_tail_flags.begin(), head_flags,         keys_output);
     thrust::scatter_if(exec, scanned_values.begin(), scanned_values.end(), scanned_tail_flags.begin(), tail_flags.begin(), values_output);
 
     return thrust::make_pair(keys_output + N, values_output + N);
@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+  // Returns the number of elements of [first1, first1 + n1) which appear among
+  // the first diag elements of the stable merge of [first1, first1 + n1) and
+  // [first2, first2 + n2). The remaining diag - result elements come from
+  // [first2, first2 + n2). Ties are broken in favor of the first range, which
+  // matches thrust::merge.
+  //
+  // Cutting a merge at several diagonals yields independent sub-merges of
+  // balanced size, which is how the host backends split a merge across threads.
+  template <typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename Size,
+            typename StrictWeakOrdering>
+    Size merge_path(RandomAccessIterator1 first1,
+                    Size n1,
+                    RandomAccessIterator2 first2,
+                    Size n2,
+                    Size diag,
+                    StrictWeakOrdering comp)
+    {
+      thrust::detail::wrapped_function<StrictWeakOrdering,bool> wrapped_comp(comp);
+
+      Size lo = (diag > n2) ? diag - n2 : Size(0);
+      Size hi = (diag < n1) ? diag : n1;
+
+      while(lo < hi)
+      {
+        Size mid = lo + (hi - lo) / 2;
+
+        // first1[mid] precedes first2[diag - mid - 1] unless it is strictly greater
+        if(!wrapped_comp(*(first2 + (diag - mid - 1)), *(first1 + mid)))
+        {
+          lo = mid + 1;
+        }
+        else
+        {
+          hi = mid;
+        }
+      }
+
+      return lo;
+    }
+
+
+  // Returns the number of elements of [first, first + n) which precede value.
+  // Works on indices so that iterators are never assigned.
+  template <typename RandomAccessIterator,
+            typename Size,
+            typename T,
+            typename StrictWeakOrdering>
+    Size lower_bound_index(RandomAccessIterator first,
+                           Size n,
+                           const T &value,
+                           StrictWeakOrdering comp)
+    {
+      Size lo = 0;
+      Size hi = n;
+
+      while(lo < hi)
+      {
+        Size mid = lo + (hi - lo) / 2;
+
+        if(comp(*(first + mid), value))
+        {
+          lo = mid + 1;
+        }
+        else
+        {
+          hi = mid;
+        }
+      }
+
+      return lo;
+    }
+
+
+  // Returns the cut (i, j) of [first1, first1 + n1) and [first2, first2 + n2)
+  // nearest to the merge path cut at diag such that no run of equivalent
+  // elements straddles it in either range: everything before the cut precedes
+  // everything after it. The set operations match equivalent elements across
+  // the two ranges, so cutting both ranges there yields independent
+  // subproblems. The cut never lies past the merge path cut, so increasing
+  // diagonals yield nondecreasing cuts.
+  template <typename RandomAccessIterator1,
+            typename RandomAccessIterator2,
+            typename Size,
+            typename StrictWeakOrdering>
+    thrust::pair<Size,Size> set_operation_path(RandomAccessIterator1 first1,
+                                               Size n1,
+                                               RandomAccessIterator2 first2,
+                                               Size n2,
+                                               Size diag,
+                                               StrictWeakOrdering comp)
+    {
+      thrust::detail::wrapped_function<StrictWeakOrdering,bool> wrapped_comp(comp);
+
+      Size i = merge_path(first1, n1, first2, n2, diag, comp);
+      Size j = diag - i;
+
+      if(i < n1 && (j == n2 || !wrapped_comp(*(first2 + j), *(first1 + i))))
+      {
+        // the merge continues with first1[i]; back up to the start of its run
+        typename thrust::iterator_value<RandomAccessIterator1>::type pivot = *(first1 + i);
+
+        i = lower_bound_index(first1, i, pivot, wrapped_comp);
+        j = lower_bound_index(first2, j, pivot, wrapped_comp);
+      }
+      else if(j < n2)
+      {
+        // the merge continues with first2[j]; back up to the start of its run
+        typename thrust::iterator_value<RandomAccessIterator2>::type pivot = *(first2 + j);
+
+        i = lower_bound_index(first1, i, pivot, wrapped_comp);
+        j = lower_bound_index(first2, j, pivot, wrapped_comp);
+      }
+
+      return thrust::make_pair(i, j);
+    }
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,124 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file min_parallel_size.h
+ *  \brief The input sizes below which the host backends run an algorithm sequentially
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// The algorithms of the table. Forking and joining a team of threads costs a
+// few microseconds, so each algorithm is worth parallelizing once its
+// sequential version would take a few times longer than that. min_bytes is
+// an estimate of how much input that takes for a 4-byte type, and
+// min_elements bounds the cutoff from below for large types. These are
+// placeholder thresholds, rounded from the relative cost per element of each
+// algorithm rather than tuned on any particular host; policies whose
+// workloads differ pass their own cutoff through min_parallel_size(n).
+// for_each, which transform and tabulate run through, costs whatever its
+// functor costs, so it has no cutoff unless the policy sets one.
+struct for_each_algorithm       { static const std::size_t min_bytes =          0; static const std::size_t min_elements =    0; };
+struct copy_algorithm           { static const std::size_t min_bytes = 256 * 1024; static const std::size_t min_elements = 1024; };
+struct fill_algorithm           { static const std::size_t min_bytes = 256 * 1024; static const std::size_t min_elements = 1024; };
+struct reduce_algorithm         { static const std::size_t min_bytes = 256 * 1024; static const std::size_t min_elements = 1024; };
+struct find_algorithm           { static const std::size_t min_bytes = 256 * 1024; static const std::size_t min_elements = 1024; };
+struct scan_algorithm           { static const std::size_t min_bytes = 128 * 1024; static const std::size_t min_elements = 1024; };
+struct scan_by_key_algorithm    { static const std::size_t min_bytes = 128 * 1024; static const std::size_t min_elements = 1024; };
+struct reduce_by_key_algorithm  { static const std::size_t min_bytes = 128 * 1024; static const std::size_t min_elements = 1024; };
+struct copy_if_algorithm        { static const std::size_t min_bytes =  64 * 1024; static const std::size_t min_elements = 1024; };
+struct partition_algorithm      { static const std::size_t min_bytes =  16 * 1024; static const std::size_t min_elements =  512; };
+struct merge_algorithm          { static const std::size_t min_bytes =  32 * 1024; static const std::size_t min_elements =  512; };
+struct set_operation_algorithm  { static const std::size_t min_bytes =  64 * 1024; static const std::size_t min_elements =  512; };
+struct shuffle_algorithm        { static const std::size_t min_bytes =   1 * 1024; static const std::size_t min_elements =  256; };
+struct sort_algorithm           { static const std::size_t min_bytes =   4 * 1024; static const std::size_t min_elements =  256; };
+struct binary_search_algorithm  { static const std::size_t min_bytes =   1 * 1024; static const std::size_t min_elements =   64; };
+
+
+// The fewest elements of type T for which a host backend runs Algorithm in
+// parallel; below it, the sequential version is faster. Larger elements cost
+// more apiece, so fewer of them make the cutoff. Specialize it to tune the
+// cutoff of an algorithm for a particular type.
+template<typename Algorithm, typename T>
+struct min_parallel_size
+{
+  static const std::size_t by_bytes = Algorithm::min_bytes / sizeof(T);
+
+  static const std::size_t value = by_bytes > Algorithm::min_elements ? by_bytes : Algorithm::min_elements;
+};
+
+// iterators without a value type, e.g. output iterators, get the floor
+template<typename Algorithm>
+struct min_parallel_size<Algorithm,void>
+{
+  static const std::size_t value = Algorithm::min_elements;
+};
+
+
+// fallback for policies which don't carry a minimum parallel size; zero
+// leaves the choice to the table above. The policies of the host backends
+// which do carry one provide get_min_parallel_size as a friend.
+template<typename DerivedPolicy>
+std::size_t get_min_parallel_size(thrust::execution_policy<DerivedPolicy> &)
+{
+  return 0;
+}
+
+
+// the cutoff of exec for Algorithm over elements of type T
+template<typename Algorithm, typename T, typename DerivedPolicy>
+std::size_t min_parallel_size_of(thrust::execution_policy<DerivedPolicy> &exec)
+{
+  const std::size_t result = get_min_parallel_size(thrust::detail::derived_cast(exec));
+
+  return result > 0 ? result : min_parallel_size<Algorithm,T>::value;
+}
+
+
+// true iff n elements of type T are too few for Algorithm to run in parallel
+template<typename Algorithm, typename T, typename DerivedPolicy, typename Size>
+bool below_min_parallel_size(thrust::execution_policy<DerivedPolicy> &exec, Size n)
+{
+  return !(n > Size(0)) || static_cast<std::size_t>(n) < min_parallel_size_of<Algorithm,T>(exec);
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,244 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_binary_search.h
+ *  \brief Searches for many values at once, parallelized over tiles by a host backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace binary_search_detail
+{
+
+
+// The kinds of search. Each looks for the first position in the haystack
+// whose element isn't before the value, and turns it into its result.
+struct lower_bound_search
+{
+  template<typename T1, typename T2, typename StrictWeakOrdering>
+  static bool before(const T1 &element, const T2 &value, StrictWeakOrdering &comp)
+  {
+    return comp(element, value);
+  }
+
+  template<typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+  static Size result(RandomAccessIterator, Size, Size position, const T &, StrictWeakOrdering &)
+  {
+    return position;
+  }
+};
+
+
+struct upper_bound_search
+{
+  template<typename T1, typename T2, typename StrictWeakOrdering>
+  static bool before(const T1 &element, const T2 &value, StrictWeakOrdering &comp)
+  {
+    return !comp(value, element);
+  }
+
+  template<typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+  static Size result(RandomAccessIterator, Size, Size position, const T &, StrictWeakOrdering &)
+  {
+    return position;
+  }
+};
+
+
+struct binary_search_search
+{
+  template<typename T1, typename T2, typename StrictWeakOrdering>
+  static bool before(const T1 &element, const T2 &value, StrictWeakOrdering &comp)
+  {
+    return comp(element, value);
+  }
+
+  template<typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+  static bool result(RandomAccessIterator haystack, Size n, Size position, const T &value, StrictWeakOrdering &comp)
+  {
+    return position != n && !comp(value, haystack[position]);
+  }
+};
+
+
+// the first position in [first, last) whose element isn't before value, or last
+template<typename Search, typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+Size bisect(RandomAccessIterator haystack, Size first, Size last, const T &value, StrictWeakOrdering &comp)
+{
+  while(first < last)
+  {
+    const Size middle = first + (last - first) / 2;
+
+    if(Search::before(haystack[middle], value, comp))
+    {
+      first = middle + 1;
+    }
+    else
+    {
+      last = middle;
+    }
+  }
+
+  return first;
+}
+
+
+// Searches the values of one tile in order. While the values ascend, each
+// search gallops forward from where the previous one ended, costing O(log d)
+// comparisons for a distance d between the two positions rather than
+// O(log n), and walking the haystack front to back as a merge would. The
+// first value which sorts before its predecessor shows the values aren't
+// sorted, and it and the rest of the tile are bisected over the whole
+// haystack, so unsorted values cost no more than plain binary search.
+template<typename Search,
+         typename RandomAccessIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+struct search_tile
+{
+  RandomAccessIterator                                      haystack;
+  Size                                                      n;
+  InputIterator                                             values;
+  OutputIterator                                            output;
+  uniform_decomposition<Size>                               tiles;
+  thrust::detail::wrapped_function<StrictWeakOrdering,bool> comp;
+
+  search_tile(RandomAccessIterator haystack,
+              Size n,
+              InputIterator values,
+              OutputIterator output,
+              uniform_decomposition<Size> tiles,
+              StrictWeakOrdering comp)
+    : haystack(haystack), n(n), values(values), output(output), tiles(tiles), comp(comp)
+  {}
+
+  // the position of value, which doesn't sort before position first
+  template<typename T>
+  Size gallop(const T &value, Size first) const
+  {
+    // gallop to bracket the position in [first, last]
+    Size step = 1;
+    Size last = n;
+
+    while(n - first >= step)
+    {
+      const Size probe = first + step - 1;
+
+      if(!Search::before(haystack[probe], value, comp))
+      {
+        last = probe;
+        break;
+      }
+
+      first = probe + 1;
+      step *= 2;
+    }
+
+    return bisect<Search>(haystack, first, last, value, comp);
+  }
+
+  void operator()(Size tile) const
+  {
+    typedef typename thrust::iterator_value<InputIterator>::type T;
+
+    index_range<Size> range = tiles[tile];
+
+    Size position  = 0;
+    bool ascending = true;
+
+    for(Size i = range.begin(); i < range.end(); ++i)
+    {
+      const T value = values[i];
+
+      // the value sorts before the previous one
+      if(ascending && position > 0 && !Search::before(haystack[position - 1], value, comp))
+      {
+        ascending = false;
+      }
+
+      position = ascending ? gallop(value, position) : bisect<Search>(haystack, Size(0), n, value, comp);
+
+      output[i] = Search::result(haystack, n, position, value, comp);
+    }
+  }
+};
+
+
+} // end namespace binary_search_detail
+
+
+// Searches [haystack, haystack + n) for each of [values, values + m), split
+// into num_tiles tiles, and writes Search's result for values[i] to
+// output[i]. Within a tile, ascending values gallop forward from the previous
+// result, so sorted values make for a merge of the two sequences costing
+// O(m log(n / m)) comparisons in all, which streams through the haystack.
+// From the first descent on, a tile's values are bisected as usual.
+// for_each_tile(num_tiles, f) must invoke f(tile) for every tile in
+// [0, num_tiles), in any order and concurrently if it likes.
+template<typename Search,
+         typename ForEachTile,
+         typename RandomAccessIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+OutputIterator parallel_binary_search(ForEachTile for_each_tile,
+                                      RandomAccessIterator haystack,
+                                      Size n,
+                                      InputIterator values,
+                                      Size m,
+                                      OutputIterator output,
+                                      Size num_tiles,
+                                      StrictWeakOrdering comp)
+{
+  using namespace binary_search_detail;
+
+  uniform_decomposition<Size> tiles(m, 1, num_tiles);
+
+  for_each_tile(tiles.size(),
+                search_tile<Search,RandomAccessIterator,InputIterator,OutputIterator,Size,StrictWeakOrdering>
+                  (haystack, n, values, output, tiles, comp));
+
+  return output + m;
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,169 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_copy_if.h
+ *  \brief Stream compaction, parallelized over tiles by a host backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace copy_if_detail
+{
+
+
+// evaluates pred on the stencil of tile i and counts the true elements into
+// counts[i + 1]
+template<typename InputIterator,
+         typename Predicate,
+         typename Size>
+struct count_tile
+{
+  InputIterator                                    stencil;
+  bool                                            *flags;
+  Size                                            *counts;
+  uniform_decomposition<Size>                      tiles;
+  thrust::detail::wrapped_function<Predicate,bool> pred;
+
+  count_tile(InputIterator stencil, bool *flags, Size *counts, uniform_decomposition<Size> tiles, Predicate pred)
+    : stencil(stencil), flags(flags), counts(counts), tiles(tiles), pred(pred)
+  {}
+
+  void operator()(Size i) const
+  {
+    Size count = 0;
+
+    for(Size j = tiles[i].begin(); j < tiles[i].end(); ++j)
+    {
+      const bool flag = pred(*(stencil + j));
+      flags[j] = flag;
+      count += flag;
+    }
+
+    counts[i + 1] = count;
+  }
+};
+
+
+// copies the true elements of tile i to their final position
+template<typename InputIterator,
+         typename OutputIterator,
+         typename Size>
+struct emit_tile
+{
+  InputIterator               first;
+  OutputIterator              result;
+  const bool                 *flags;
+  const Size                 *offsets;
+  uniform_decomposition<Size> tiles;
+
+  emit_tile(InputIterator first, OutputIterator result, const bool *flags, const Size *offsets, uniform_decomposition<Size> tiles)
+    : first(first), result(result), flags(flags), offsets(offsets), tiles(tiles)
+  {}
+
+  void operator()(Size i) const
+  {
+    OutputIterator out = result + offsets[i];
+
+    for(Size j = tiles[i].begin(); j < tiles[i].end(); ++j)
+    {
+      if(flags[j])
+      {
+        *out = *(first + j);
+        ++out;
+      }
+    }
+  }
+};
+
+
+} // end namespace copy_if_detail
+
+
+// Copies the elements of [first, first + n) whose stencil satisfies pred to
+// result, split into num_tiles tiles. A first parallel pass evaluates pred
+// once per element and counts each tile's true elements, a sequential pass
+// scans the counts into each tile's output offset, and a second parallel pass
+// writes every true element directly to its final position. Temporary storage
+// is one flag per element. for_each_tile(num_tiles, f) must invoke f(tile)
+// for every tile in [0, num_tiles), in any order and concurrently if it
+// likes.
+template<typename DerivedPolicy,
+         typename ForEachTile,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename Size,
+         typename Predicate>
+OutputIterator parallel_copy_if(thrust::execution_policy<DerivedPolicy> &exec,
+                                ForEachTile for_each_tile,
+                                InputIterator1 first,
+                                InputIterator2 stencil,
+                                OutputIterator result,
+                                Size n,
+                                Size num_tiles,
+                                Predicate pred)
+{
+  using namespace copy_if_detail;
+
+  uniform_decomposition<Size> tiles(n, 1, num_tiles);
+
+  thrust::detail::temporary_array<bool,DerivedPolicy> flags(0, exec, n);
+  bool *flags_ptr = thrust::raw_pointer_cast(flags.data());
+
+  // offsets[i] is the number of true elements preceding tile i
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets(0, exec, tiles.size() + 1);
+  Size *offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  offsets_ptr[0] = 0;
+
+  for_each_tile(tiles.size(), count_tile<InputIterator2,Predicate,Size>(stencil, flags_ptr, offsets_ptr, tiles, pred));
+
+  for(Size i = 0; i < tiles.size(); ++i)
+  {
+    offsets_ptr[i + 1] += offsets_ptr[i];
+  }
+
+  for_each_tile(tiles.size(), emit_tile<InputIterator1,OutputIterator,Size>(first, result, flags_ptr, offsets_ptr, tiles));
+
+  return result + offsets_ptr[tiles.size()];
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
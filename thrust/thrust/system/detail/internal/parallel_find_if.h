@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_find_if.h
+ *  \brief Searches which stop early, parallelized by a host backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <atomic>
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace find_if_detail
+{
+
+
+// the most bytes of input one block covers, roughly an L1 cache's worth
+const static std::size_t max_block_bytes = 32 * 1024;
+
+
+// the size of the blocks a search hands out: small enough that every worker
+// gets a few, so an early match is found early, but no larger than
+// max_block_bytes, so the workers notice a match soon after it's found
+template<typename T, typename Size>
+Size block_size(Size n, Size num_workers)
+{
+  const Size max_size = thrust::max<Size>(1, Size(max_block_bytes / sizeof(T)));
+
+  return thrust::max<Size>(1, thrust::min<Size>(max_size, n / (4 * num_workers)));
+}
+
+
+// Claims blocks of the input in increasing order until they run out or begin
+// past the first match found so far, and lowers that match to the first
+// element of a claimed block which satisfies pred.
+template<typename InputIterator, typename Size, typename Predicate>
+struct search_blocks
+{
+  InputIterator                                    first;
+  Size                                             n;
+  Size                                             block;
+  thrust::detail::wrapped_function<Predicate,bool> pred;
+  std::atomic<Size>                               *next_block;
+  std::atomic<Size>                               *result;
+
+  search_blocks(InputIterator first,
+                Size n,
+                Size block,
+                Predicate pred,
+                std::atomic<Size> *next_block,
+                std::atomic<Size> *result)
+    : first(first), n(n), block(block), pred(pred), next_block(next_block), result(result)
+  {}
+
+  void operator()(Size) const
+  {
+    for(;;)
+    {
+      const Size begin = block * next_block->fetch_add(1, std::memory_order_relaxed);
+
+      // every block claimed from now on begins even later
+      if(begin >= result->load(std::memory_order_relaxed))
+        return;
+
+      const Size end = thrust::min<Size>(begin + block, n);
+
+      for(Size i = begin; i < end; ++i)
+      {
+        if(pred(first[i]))
+        {
+          Size current = result->load(std::memory_order_relaxed);
+
+          while(i < current && !result->compare_exchange_weak(current, i, std::memory_order_relaxed))
+          {}
+
+          return;
+        }
+      }
+    }
+  }
+};
+
+
+} // end namespace find_if_detail
+
+
+// Returns the first iterator i in [first, first + n) for which pred(*i) is
+// true, or first + n. num_workers workers claim blocks of the input in
+// increasing order from a shared counter and record a match by lowering a
+// shared index, so no block after the first match is begun once it's been
+// found, and at most one block per worker is searched beyond it.
+// for_each_tile(num_workers, f) must invoke f(worker) for every worker in
+// [0, num_workers), in any order and concurrently if it likes.
+template<typename ForEachTile,
+         typename InputIterator,
+         typename Size,
+         typename Predicate>
+InputIterator parallel_find_if(ForEachTile for_each_tile,
+                               InputIterator first,
+                               Size n,
+                               Size num_workers,
+                               Predicate pred)
+{
+  using namespace find_if_detail;
+
+  typedef typename thrust::iterator_value<InputIterator>::type T;
+
+  std::atomic<Size> next_block(0);
+  std::atomic<Size> result(n);
+
+  for_each_tile(num_workers,
+                search_blocks<InputIterator,Size,Predicate>
+                  (first, n, block_size<T>(n, num_workers), pred, &next_block, &result));
+
+  return first + result.load();
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,220 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_merge.h
+ *  \brief Merges, parallelized over tiles by a host backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/seq.h>
+#include <thrust/merge.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace merge_detail
+{
+
+
+// merges the part of the output which lies in one tile
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+struct merge_tile
+{
+  InputIterator1              first1;
+  Size                        n1;
+  InputIterator2              first2;
+  Size                        n2;
+  OutputIterator              result;
+  uniform_decomposition<Size> tiles;
+  StrictWeakOrdering          comp;
+
+  merge_tile(InputIterator1 first1, Size n1,
+             InputIterator2 first2, Size n2,
+             OutputIterator result,
+             uniform_decomposition<Size> tiles,
+             StrictWeakOrdering comp)
+    : first1(first1), n1(n1), first2(first2), n2(n2), result(result), tiles(tiles), comp(comp)
+  {}
+
+  void operator()(Size tile) const
+  {
+    Size begin = tiles[tile].begin();
+    Size end   = tiles[tile].end();
+
+    Size begin1 = merge_path(first1, n1, first2, n2, begin, comp);
+    Size end1   = merge_path(first1, n1, first2, n2, end,   comp);
+
+    thrust::merge(thrust::seq,
+                  first1 + begin1,           first1 + end1,
+                  first2 + (begin - begin1), first2 + (end - end1),
+                  result + begin,
+                  comp);
+  }
+};
+
+
+// merges the part of the output which lies in one tile
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename InputIterator4,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+struct merge_by_key_tile
+{
+  InputIterator1              keys_first1;
+  Size                        n1;
+  InputIterator2              keys_first2;
+  Size                        n2;
+  InputIterator3              values_first1;
+  InputIterator4              values_first2;
+  OutputIterator1             keys_result;
+  OutputIterator2             values_result;
+  uniform_decomposition<Size> tiles;
+  StrictWeakOrdering          comp;
+
+  merge_by_key_tile(InputIterator1 keys_first1, Size n1,
+                    InputIterator2 keys_first2, Size n2,
+                    InputIterator3 values_first1,
+                    InputIterator4 values_first2,
+                    OutputIterator1 keys_result,
+                    OutputIterator2 values_result,
+                    uniform_decomposition<Size> tiles,
+                    StrictWeakOrdering comp)
+    : keys_first1(keys_first1), n1(n1), keys_first2(keys_first2), n2(n2),
+      values_first1(values_first1), values_first2(values_first2),
+      keys_result(keys_result), values_result(values_result),
+      tiles(tiles), comp(comp)
+  {}
+
+  void operator()(Size tile) const
+  {
+    Size begin = tiles[tile].begin();
+    Size end   = tiles[tile].end();
+
+    Size begin1 = merge_path(keys_first1, n1, keys_first2, n2, begin, comp);
+    Size end1   = merge_path(keys_first1, n1, keys_first2, n2, end,   comp);
+
+    thrust::merge_by_key(thrust::seq,
+                         keys_first1 + begin1,           keys_first1 + end1,
+                         keys_first2 + (begin - begin1), keys_first2 + (end - end1),
+                         values_first1 + begin1,
+                         values_first2 + (begin - begin1),
+                         keys_result + begin,
+                         values_result + begin,
+                         comp);
+  }
+};
+
+
+} // end namespace merge_detail
+
+
+// Merges [first1, first1 + n1) and [first2, first2 + n2) into result, whose
+// n1 + n2 elements are split into num_tiles tiles. Every tile is an
+// independent merge of the inputs' cuts along the merge path at its ends, so
+// no temporary storage is needed. for_each_tile(num_tiles, f) must invoke
+// f(tile) for every tile in [0, num_tiles), in any order and concurrently if
+// it likes.
+template<typename ForEachTile,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+OutputIterator parallel_merge(ForEachTile for_each_tile,
+                              InputIterator1 first1,
+                              Size n1,
+                              InputIterator2 first2,
+                              Size n2,
+                              OutputIterator result,
+                              Size num_tiles,
+                              StrictWeakOrdering comp)
+{
+  using namespace merge_detail;
+
+  uniform_decomposition<Size> tiles(n1 + n2, 1, num_tiles);
+
+  for_each_tile(tiles.size(),
+                merge_tile<InputIterator1,InputIterator2,OutputIterator,Size,StrictWeakOrdering>
+                  (first1, n1, first2, n2, result, tiles, comp));
+
+  return result + (n1 + n2);
+}
+
+
+// the same as parallel_merge, carrying values along with the keys
+template<typename ForEachTile,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename InputIterator4,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+  parallel_merge_by_key(ForEachTile for_each_tile,
+                        InputIterator1 keys_first1,
+                        Size n1,
+                        InputIterator2 keys_first2,
+                        Size n2,
+                        InputIterator3 values_first1,
+                        InputIterator4 values_first2,
+                        OutputIterator1 keys_result,
+                        OutputIterator2 values_result,
+                        Size num_tiles,
+                        StrictWeakOrdering comp)
+{
+  using namespace merge_detail;
+
+  uniform_decomposition<Size> tiles(n1 + n2, 1, num_tiles);
+
+  for_each_tile(tiles.size(),
+                merge_by_key_tile<InputIterator1,InputIterator2,InputIterator3,InputIterator4,OutputIterator1,OutputIterator2,Size,StrictWeakOrdering>
+                  (keys_first1, n1, keys_first2, n2, values_first1, values_first2, keys_result, values_result, tiles, comp));
+
+  return thrust::make_pair(keys_result + (n1 + n2), values_result + (n1 + n2));
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,336 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_merge_sort.h
+ *  \brief Stable merge sorts, parallelized over tiles by a host backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/merge.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace merge_sort_detail
+{
+
+
+// the offset of the first element of run i, where runs past the end are empty
+template<typename Size>
+Size run_begin(const uniform_decomposition<Size> &runs, Size n, Size i)
+{
+  return (i < runs.size()) ? runs[i].begin() : n;
+}
+
+
+template<typename RandomAccessIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+struct sort_tile
+{
+  RandomAccessIterator        first;
+  uniform_decomposition<Size> tiles;
+  StrictWeakOrdering          comp;
+
+  sort_tile(RandomAccessIterator first, uniform_decomposition<Size> tiles, StrictWeakOrdering comp)
+    : first(first), tiles(tiles), comp(comp)
+  {}
+
+  void operator()(Size i) const
+  {
+    thrust::stable_sort(thrust::seq, first + tiles[i].begin(), first + tiles[i].end(), comp);
+  }
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+struct sort_by_key_tile
+{
+  RandomAccessIterator1       keys_first;
+  RandomAccessIterator2       values_first;
+  uniform_decomposition<Size> tiles;
+  StrictWeakOrdering          comp;
+
+  sort_by_key_tile(RandomAccessIterator1 keys_first, RandomAccessIterator2 values_first, uniform_decomposition<Size> tiles, StrictWeakOrdering comp)
+    : keys_first(keys_first), values_first(values_first), tiles(tiles), comp(comp)
+  {}
+
+  void operator()(Size i) const
+  {
+    thrust::stable_sort_by_key(thrust::seq, keys_first + tiles[i].begin(), keys_first + tiles[i].end(), values_first + tiles[i].begin(), comp);
+  }
+};
+
+
+// Merges each pair of adjacent sorted runs, width tiles wide, from src into dst.
+// Tile i produces the part of the output which lies in tiles[i], cutting its
+// merge along the merge path.
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+struct merge_runs_tile
+{
+  RandomAccessIterator1       src;
+  RandomAccessIterator2       dst;
+  uniform_decomposition<Size> tiles;
+  Size                        n, width;
+  StrictWeakOrdering          comp;
+
+  merge_runs_tile(RandomAccessIterator1 src, RandomAccessIterator2 dst, uniform_decomposition<Size> tiles, Size n, Size width, StrictWeakOrdering comp)
+    : src(src), dst(dst), tiles(tiles), n(n), width(width), comp(comp)
+  {}
+
+  void operator()(Size i) const
+  {
+    // the tile's output lies within the merge of the pair of runs containing it
+    const Size run = i - i % (2 * width);
+
+    const Size begin1 = run_begin(tiles, n, run);
+    const Size begin2 = run_begin(tiles, n, run + width);
+    const Size end2   = run_begin(tiles, n, run + 2 * width);
+
+    // the part of this merge's output which belongs to this tile
+    const Size lo = tiles[i].begin() - begin1;
+    const Size hi = tiles[i].end()   - begin1;
+
+    const Size i0 = merge_path(src + begin1, begin2 - begin1, src + begin2, end2 - begin2, lo, comp);
+    const Size i1 = merge_path(src + begin1, begin2 - begin1, src + begin2, end2 - begin2, hi, comp);
+
+    thrust::merge(thrust::seq,
+                  src + begin1 + i0, src + begin1 + i1,
+                  src + begin2 + (lo - i0), src + begin2 + (hi - i1),
+                  dst + begin1 + lo,
+                  comp);
+  }
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Size,
+         typename StrictWeakOrdering>
+struct merge_runs_by_key_tile
+{
+  RandomAccessIterator1       keys_src;
+  RandomAccessIterator2       values_src;
+  RandomAccessIterator3       keys_dst;
+  RandomAccessIterator4       values_dst;
+  uniform_decomposition<Size> tiles;
+  Size                        n, width;
+  StrictWeakOrdering          comp;
+
+  merge_runs_by_key_tile(RandomAccessIterator1 keys_src, RandomAccessIterator2 values_src,
+                         RandomAccessIterator3 keys_dst, RandomAccessIterator4 values_dst,
+                         uniform_decomposition<Size> tiles, Size n, Size width, StrictWeakOrdering comp)
+    : keys_src(keys_src), values_src(values_src), keys_dst(keys_dst), values_dst(values_dst), tiles(tiles), n(n), width(width), comp(comp)
+  {}
+
+  void operator()(Size i) const
+  {
+    // the tile's output lies within the merge of the pair of runs containing it
+    const Size run = i - i % (2 * width);
+
+    const Size begin1 = run_begin(tiles, n, run);
+    const Size begin2 = run_begin(tiles, n, run + width);
+    const Size end2   = run_begin(tiles, n, run + 2 * width);
+
+    // the part of this merge's output which belongs to this tile
+    const Size lo = tiles[i].begin() - begin1;
+    const Size hi = tiles[i].end()   - begin1;
+
+    const Size i0 = merge_path(keys_src + begin1, begin2 - begin1, keys_src + begin2, end2 - begin2, lo, comp);
+    const Size i1 = merge_path(keys_src + begin1, begin2 - begin1, keys_src + begin2, end2 - begin2, hi, comp);
+
+    thrust::merge_by_key(thrust::seq,
+                         keys_src + begin1 + i0, keys_src + begin1 + i1,
+                         keys_src + begin2 + (lo - i0), keys_src + begin2 + (hi - i1),
+                         values_src + begin1 + i0,
+                         values_src + begin2 + (lo - i0),
+                         keys_dst + begin1 + lo,
+                         values_dst + begin1 + lo,
+                         comp);
+  }
+};
+
+
+// copies tile i of src back to dst
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size>
+struct copy_tile
+{
+  RandomAccessIterator1       src;
+  RandomAccessIterator2       dst;
+  uniform_decomposition<Size> tiles;
+
+  copy_tile(RandomAccessIterator1 src, RandomAccessIterator2 dst, uniform_decomposition<Size> tiles)
+    : src(src), dst(dst), tiles(tiles)
+  {}
+
+  void operator()(Size i) const
+  {
+    for(Size j = tiles[i].begin(); j < tiles[i].end(); ++j)
+    {
+      dst[j] = src[j];
+    }
+  }
+};
+
+
+} // end namespace merge_sort_detail
+
+
+// Stably sorts [first, first + n), split into num_tiles tiles. Every tile is
+// sorted on its own, then pairs of adjacent runs are merged until a single
+// run remains, ping-ponging between the input and a buffer of n elements.
+// Every merge is cut along the merge path so that each level keeps all tiles
+// busy. for_each_tile(num_tiles, f) must invoke f(tile) for every tile in
+// [0, num_tiles), in any order and concurrently if it likes.
+template<typename DerivedPolicy,
+         typename ForEachTile,
+         typename RandomAccessIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+void parallel_merge_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                         ForEachTile for_each_tile,
+                         RandomAccessIterator first,
+                         Size n,
+                         Size num_tiles,
+                         StrictWeakOrdering comp)
+{
+  using namespace merge_sort_detail;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  uniform_decomposition<Size> tiles(n, 1, num_tiles);
+
+  for_each_tile(tiles.size(), sort_tile<RandomAccessIterator,Size,StrictWeakOrdering>(first, tiles, comp));
+
+  thrust::detail::temporary_array<value_type,DerivedPolicy> temp(exec, n);
+  value_type *temp_ptr = thrust::raw_pointer_cast(temp.data());
+
+  bool sorted_into_temp = false;
+
+  for(Size width = 1; width < tiles.size(); width *= 2)
+  {
+    if(sorted_into_temp)
+    {
+      for_each_tile(tiles.size(), merge_runs_tile<value_type*,RandomAccessIterator,Size,StrictWeakOrdering>(temp_ptr, first, tiles, n, width, comp));
+    }
+    else
+    {
+      for_each_tile(tiles.size(), merge_runs_tile<RandomAccessIterator,value_type*,Size,StrictWeakOrdering>(first, temp_ptr, tiles, n, width, comp));
+    }
+
+    sorted_into_temp = !sorted_into_temp;
+  }
+
+  // an odd number of levels leaves the result in the buffer
+  if(sorted_into_temp)
+  {
+    for_each_tile(tiles.size(), copy_tile<value_type*,RandomAccessIterator,Size>(temp_ptr, first, tiles));
+  }
+}
+
+
+// the same as parallel_merge_sort, carrying values along with the keys
+template<typename DerivedPolicy,
+         typename ForEachTile,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+void parallel_merge_sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                                ForEachTile for_each_tile,
+                                RandomAccessIterator1 keys_first,
+                                RandomAccessIterator2 values_first,
+                                Size n,
+                                Size num_tiles,
+                                StrictWeakOrdering comp)
+{
+  using namespace merge_sort_detail;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type key_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type value_type;
+
+  uniform_decomposition<Size> tiles(n, 1, num_tiles);
+
+  for_each_tile(tiles.size(), sort_by_key_tile<RandomAccessIterator1,RandomAccessIterator2,Size,StrictWeakOrdering>(keys_first, values_first, tiles, comp));
+
+  thrust::detail::temporary_array<key_type,DerivedPolicy>   keys_temp(exec, n);
+  thrust::detail::temporary_array<value_type,DerivedPolicy> values_temp(exec, n);
+  key_type   *keys_temp_ptr   = thrust::raw_pointer_cast(keys_temp.data());
+  value_type *values_temp_ptr = thrust::raw_pointer_cast(values_temp.data());
+
+  bool sorted_into_temp = false;
+
+  for(Size width = 1; width < tiles.size(); width *= 2)
+  {
+    if(sorted_into_temp)
+    {
+      for_each_tile(tiles.size(),
+                    merge_runs_by_key_tile<key_type*,value_type*,RandomAccessIterator1,RandomAccessIterator2,Size,StrictWeakOrdering>
+                      (keys_temp_ptr, values_temp_ptr, keys_first, values_first, tiles, n, width, comp));
+    }
+    else
+    {
+      for_each_tile(tiles.size(),
+                    merge_runs_by_key_tile<RandomAccessIterator1,RandomAccessIterator2,key_type*,value_type*,Size,StrictWeakOrdering>
+                      (keys_first, values_first, keys_temp_ptr, values_temp_ptr, tiles, n, width, comp));
+    }
+
+    sorted_into_temp = !sorted_into_temp;
+  }
+
+  // an odd number of levels leaves the result in the buffers
+  if(sorted_into_temp)
+  {
+    for_each_tile(tiles.size(), copy_tile<key_type*,RandomAccessIterator1,Size>(keys_temp_ptr, keys_first, tiles));
+    for_each_tile(tiles.size(), copy_tile<value_type*,RandomAccessIterator2,Size>(values_temp_ptr, values_first, tiles));
+  }
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
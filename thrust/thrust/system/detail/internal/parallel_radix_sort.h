@@ -0,0 +1,388 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_radix_sort.h
+ *  \brief LSD radix sort of primitive keys, parallelized over tiles by a
+ *         host backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/functional.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace radix_sort_detail
+{
+
+
+const static unsigned int radix_bits  = 8;
+const static unsigned int num_buckets = 1u << radix_bits;
+
+
+// maps a key to an unsigned integer whose natural order is the requested order
+template<typename KeyType, bool Descending>
+struct radix_key
+{
+  typedef sequential::radix_sort_detail::RadixEncoder<KeyType> encoder_type;
+  typedef typename encoder_type::result_type                    result_type;
+
+  result_type operator()(const KeyType &key) const
+  {
+    result_type x = encoder_type()(key);
+
+    return Descending ? static_cast<result_type>(~x) : x;
+  }
+};
+
+
+template<typename KeyType, bool Descending>
+struct digit_of
+{
+  unsigned int shift;
+
+  digit_of(unsigned int shift)
+    : shift(shift)
+  {}
+
+  unsigned int operator()(const KeyType &key) const
+  {
+    return static_cast<unsigned int>(radix_key<KeyType,Descending>()(key) >> shift) & (num_buckets - 1);
+  }
+};
+
+
+// counts the digits of one tile of keys
+template<typename KeyType, bool Descending, typename RandomAccessIterator, typename Size>
+struct count_digits
+{
+  RandomAccessIterator             keys;
+  uniform_decomposition<Size>      tiles;
+  digit_of<KeyType,Descending>     digit;
+  Size                            *counts;
+
+  count_digits(RandomAccessIterator keys, uniform_decomposition<Size> tiles, unsigned int shift, Size *counts)
+    : keys(keys), tiles(tiles), digit(shift), counts(counts)
+  {}
+
+  void operator()(Size tile) const
+  {
+    Size *tile_counts = counts + tile * num_buckets;
+
+    for(unsigned int b = 0; b < num_buckets; ++b)
+    {
+      tile_counts[b] = 0;
+    }
+
+    index_range<Size> range = tiles[tile];
+
+    for(Size i = range.begin(); i < range.end(); ++i)
+    {
+      ++tile_counts[digit(keys[i])];
+    }
+  }
+};
+
+
+// moves one tile of keys (and values) to their positions for this pass
+template<typename KeyType,
+         bool Descending,
+         bool HasValues,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Size>
+struct scatter_digits
+{
+  RandomAccessIterator1            keys_first;
+  RandomAccessIterator2            values_first;
+  RandomAccessIterator3            keys_result;
+  RandomAccessIterator4            values_result;
+  uniform_decomposition<Size>      tiles;
+  digit_of<KeyType,Descending>     digit;
+  Size                            *offsets;
+
+  scatter_digits(RandomAccessIterator1 keys_first,
+                 RandomAccessIterator2 values_first,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result,
+                 uniform_decomposition<Size> tiles,
+                 unsigned int shift,
+                 Size *offsets)
+    : keys_first(keys_first), values_first(values_first),
+      keys_result(keys_result), values_result(values_result),
+      tiles(tiles), digit(shift), offsets(offsets)
+  {}
+
+  void operator()(Size tile) const
+  {
+    Size *tile_offsets = offsets + tile * num_buckets;
+
+    index_range<Size> range = tiles[tile];
+
+    for(Size i = range.begin(); i < range.end(); ++i)
+    {
+      KeyType key = keys_first[i];
+      Size &dst = tile_offsets[digit(key)];
+
+      keys_result[dst] = key;
+
+      if(HasValues)
+      {
+        values_result[dst] = values_first[i];
+      }
+
+      ++dst;
+    }
+  }
+};
+
+
+template<bool HasValues,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Size>
+struct copy_tiles
+{
+  RandomAccessIterator1       keys_first;
+  RandomAccessIterator2       values_first;
+  RandomAccessIterator3       keys_result;
+  RandomAccessIterator4       values_result;
+  uniform_decomposition<Size> tiles;
+
+  copy_tiles(RandomAccessIterator1 keys_first,
+             RandomAccessIterator2 values_first,
+             RandomAccessIterator3 keys_result,
+             RandomAccessIterator4 values_result,
+             uniform_decomposition<Size> tiles)
+    : keys_first(keys_first), values_first(values_first),
+      keys_result(keys_result), values_result(values_result),
+      tiles(tiles)
+  {}
+
+  void operator()(Size tile) const
+  {
+    index_range<Size> range = tiles[tile];
+
+    for(Size i = range.begin(); i < range.end(); ++i)
+    {
+      keys_result[i] = keys_first[i];
+
+      if(HasValues)
+      {
+        values_result[i] = values_first[i];
+      }
+    }
+  }
+};
+
+
+// Turns the per-tile digit counts (tile-major) into the position at which
+// each tile writes its first key of each digit. Returns false without
+// touching counts when all keys share the same digit, in which case the
+// pass is a no-op and may be skipped.
+template<typename Size>
+bool exclusive_scan_counts(Size *counts, Size num_tiles, Size n)
+{
+  for(unsigned int b = 0; b < num_buckets; ++b)
+  {
+    Size total = 0;
+
+    for(Size t = 0; t < num_tiles; ++t)
+    {
+      total += counts[t * num_buckets + b];
+    }
+
+    if(total == n)
+    {
+      return false;
+    }
+    else if(total != 0)
+    {
+      break;
+    }
+  }
+
+  Size sum = 0;
+
+  for(unsigned int b = 0; b < num_buckets; ++b)
+  {
+    for(Size t = 0; t < num_tiles; ++t)
+    {
+      Size count = counts[t * num_buckets + b];
+      counts[t * num_buckets + b] = sum;
+      sum += count;
+    }
+  }
+
+  return true;
+}
+
+
+template<typename KeyType,
+         bool Descending,
+         bool HasValues,
+         typename ForEachTile,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Size>
+void radix_sort_pass(ForEachTile for_each_tile,
+                     RandomAccessIterator1 keys_first,
+                     RandomAccessIterator2 values_first,
+                     RandomAccessIterator3 keys_result,
+                     RandomAccessIterator4 values_result,
+                     Size n,
+                     uniform_decomposition<Size> tiles,
+                     unsigned int shift,
+                     Size *counts,
+                     bool &flip)
+{
+  for_each_tile(tiles.size(), count_digits<KeyType,Descending,RandomAccessIterator1,Size>(keys_first, tiles, shift, counts));
+
+  if(exclusive_scan_counts(counts, tiles.size(), n))
+  {
+    for_each_tile(tiles.size(),
+                  scatter_digits<KeyType,Descending,HasValues,
+                                 RandomAccessIterator1,RandomAccessIterator2,
+                                 RandomAccessIterator3,RandomAccessIterator4,Size>
+                    (keys_first, values_first, keys_result, values_result, tiles, shift, counts));
+
+    flip = !flip;
+  }
+}
+
+
+} // end namespace radix_sort_detail
+
+
+// true when a stable sort of KeyType under StrictWeakOrdering is an LSD radix
+// sort of the encoded keys
+template<typename KeyType, typename StrictWeakOrdering>
+struct use_parallel_radix_sort
+  : thrust::detail::integral_constant<
+      bool,
+      ((thrust::detail::is_integral<KeyType>::value &&
+        !thrust::detail::is_same<KeyType,bool>::value &&
+        sizeof(KeyType) <= 8) ||
+       thrust::detail::is_same<KeyType,float>::value ||
+       thrust::detail::is_same<KeyType,double>::value) &&
+      (thrust::detail::is_same<StrictWeakOrdering,thrust::less<KeyType> >::value ||
+       thrust::detail::is_same<StrictWeakOrdering,thrust::greater<KeyType> >::value)
+    >
+{};
+
+
+// Stable LSD radix sort of [keys_first, keys_first + n), permuting
+// [values_first, values_first + n) alongside when HasValues is true. Keys are
+// sorted in descending order when StrictWeakOrdering is thrust::greater.
+//
+// The keys are split into num_tiles contiguous tiles. Each pass counts the
+// digits of every tile, scans the counts digit-major so that tiles keep their
+// relative order within each bucket, and scatters every tile to its own
+// disjoint set of output positions. Passes whose digit is shared by all keys
+// are skipped. for_each_tile(num_tiles, f) must invoke f(tile) for every tile
+// in [0, num_tiles), in any order and concurrently if it likes.
+template<bool HasValues,
+         typename DerivedPolicy,
+         typename ForEachTile,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+void parallel_radix_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                         ForEachTile for_each_tile,
+                         RandomAccessIterator1 keys_first,
+                         RandomAccessIterator2 values_first,
+                         Size n,
+                         Size num_tiles,
+                         StrictWeakOrdering)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type ValueType;
+
+  const bool descending = thrust::detail::is_same<StrictWeakOrdering,thrust::greater<KeyType> >::value;
+
+  typedef typename radix_sort_detail::radix_key<KeyType,descending>::result_type EncodedType;
+
+  const unsigned int num_passes = (8 * sizeof(EncodedType) + radix_sort_detail::radix_bits - 1) / radix_sort_detail::radix_bits;
+
+  uniform_decomposition<Size> tiles(n, 1, num_tiles);
+
+  thrust::detail::temporary_array<KeyType,DerivedPolicy>   keys_temp(0, exec, n);
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> values_temp(0, exec, HasValues ? n : 0);
+  thrust::detail::temporary_array<Size,DerivedPolicy>      counts(0, exec, tiles.size() * radix_sort_detail::num_buckets);
+
+  KeyType   *keys_buffer   = thrust::raw_pointer_cast(keys_temp.data());
+  ValueType *values_buffer = thrust::raw_pointer_cast(values_temp.data());
+  Size      *counts_buffer = thrust::raw_pointer_cast(counts.data());
+
+  // when flip is set, the partially sorted sequence lives in the temporary buffers
+  bool flip = false;
+
+  for(unsigned int pass = 0; pass < num_passes; ++pass)
+  {
+    unsigned int shift = pass * radix_sort_detail::radix_bits;
+
+    if(!flip)
+    {
+      radix_sort_detail::radix_sort_pass<KeyType,descending,HasValues>
+        (for_each_tile, keys_first, values_first, keys_buffer, values_buffer, n, tiles, shift, counts_buffer, flip);
+    }
+    else
+    {
+      radix_sort_detail::radix_sort_pass<KeyType,descending,HasValues>
+        (for_each_tile, keys_buffer, values_buffer, keys_first, values_first, n, tiles, shift, counts_buffer, flip);
+    }
+  }
+
+  if(flip)
+  {
+    for_each_tile(tiles.size(),
+                  radix_sort_detail::copy_tiles<HasValues,KeyType*,ValueType*,RandomAccessIterator1,RandomAccessIterator2,Size>
+                    (keys_buffer, values_buffer, keys_first, values_first, tiles));
+  }
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,136 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_reduce.h
+ *  \brief Reductions, parallelized over tiles by a host backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace reduce_detail
+{
+
+
+// reduces tile i of the input, which must not be empty, into sums[i + offset]
+template<typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction,
+         typename ValueType,
+         typename Size>
+struct reduce_tile
+{
+  InputIterator                                              input;
+  OutputIterator                                             sums;
+  Size                                                       offset;
+  uniform_decomposition<Size>                                tiles;
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> binary_op;
+
+  reduce_tile(InputIterator input,
+              OutputIterator sums,
+              Size offset,
+              uniform_decomposition<Size> tiles,
+              BinaryFunction binary_op)
+    : input(input), sums(sums), offset(offset), tiles(tiles), binary_op(binary_op)
+  {}
+
+  void operator()(Size i) const
+  {
+    InputIterator first = input + tiles[i].begin();
+    InputIterator last  = input + tiles[i].end();
+
+    // carefully pass the init value for the tile with raw_reference_cast
+    ValueType sum = thrust::raw_reference_cast(*first);
+
+    for(++first; first != last; ++first)
+    {
+      sum = binary_op(sum, *first);
+    }
+
+    sums[i + offset] = sum;
+  }
+};
+
+
+} // end namespace reduce_detail
+
+
+// Reduces [first, first + n) into init, split into num_tiles tiles. A
+// parallel pass reduces every tile to a partial sum, and a sequential pass
+// reduces the partial sums, in order, into init; binary_op need not be
+// commutative. for_each_tile(num_tiles, f) must invoke f(tile) for every tile
+// in [0, num_tiles), in any order and concurrently if it likes.
+template<typename DerivedPolicy,
+         typename ForEachTile,
+         typename InputIterator,
+         typename Size,
+         typename OutputType,
+         typename BinaryFunction>
+OutputType parallel_reduce(thrust::execution_policy<DerivedPolicy> &exec,
+                           ForEachTile for_each_tile,
+                           InputIterator first,
+                           Size n,
+                           Size num_tiles,
+                           OutputType init,
+                           BinaryFunction binary_op)
+{
+  using namespace reduce_detail;
+
+  uniform_decomposition<Size> tiles(n, 1, num_tiles);
+
+  thrust::detail::temporary_array<OutputType,DerivedPolicy> sums(exec, tiles.size());
+  OutputType *sums_ptr = thrust::raw_pointer_cast(sums.data());
+
+  for_each_tile(tiles.size(),
+                reduce_tile<InputIterator,OutputType*,BinaryFunction,OutputType,Size>
+                  (first, sums_ptr, Size(0), tiles, binary_op));
+
+  thrust::detail::wrapped_function<BinaryFunction,OutputType> wrapped_binary_op(binary_op);
+
+  for(Size i = 0; i < tiles.size(); ++i)
+  {
+    init = wrapped_binary_op(init, sums_ptr[i]);
+  }
+
+  return init;
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,322 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_reduce_by_key.h
+ *  \brief Segmented reductions, parallelized over tiles by a host backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/pair.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace reduce_by_key_detail
+{
+
+
+// true iff keys[i] belongs to the same segment as keys[i - 1]
+template<typename InputIterator1, typename Size, typename BinaryPredicate>
+bool continues_segment(InputIterator1 keys, Size i, const BinaryPredicate &binary_pred)
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type KeyType;
+
+  KeyType prev_key = keys[i - 1];
+  KeyType key      = keys[i];
+
+  return binary_pred(prev_key, key);
+}
+
+
+// Counts the segments which end in one tile. If the tile's last segment runs
+// on into the next tile, also reduces the part of it inside the tile and
+// records where it begins.
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename ValueType,
+         typename Size,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+struct count_tile
+{
+  InputIterator1                                         keys;
+  InputIterator2                                         values;
+  Size                                                   n;
+  uniform_decomposition<Size>                            tiles;
+  thrust::detail::wrapped_function<BinaryPredicate,bool> binary_pred;
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> binary_op;
+  Size                                                  *counts;
+  Size                                                  *heads;
+  ValueType                                             *sums;
+
+  count_tile(InputIterator1 keys,
+             InputIterator2 values,
+             Size n,
+             uniform_decomposition<Size> tiles,
+             BinaryPredicate binary_pred,
+             BinaryFunction binary_op,
+             Size *counts,
+             Size *heads,
+             ValueType *sums)
+    : keys(keys), values(values), n(n), tiles(tiles),
+      binary_pred(binary_pred), binary_op(binary_op),
+      counts(counts), heads(heads), sums(sums)
+  {}
+
+  void operator()(Size tile) const
+  {
+    index_range<Size> range = tiles[tile];
+
+    Size count = 0;
+
+    for(Size i = range.begin(); i < range.end(); ++i)
+    {
+      if(i + 1 == n || !continues_segment(keys, i + 1, binary_pred))
+      {
+        ++count;
+      }
+    }
+
+    counts[tile] = count;
+
+    if(range.end() < n && continues_segment(keys, range.end(), binary_pred))
+    {
+      // walk back to the head of the last segment
+      Size head = range.end() - 1;
+
+      while(head > range.begin() && continues_segment(keys, head, binary_pred))
+      {
+        --head;
+      }
+
+      ValueType sum = values[head];
+
+      for(Size i = head + 1; i < range.end(); ++i)
+      {
+        sum = binary_op(sum, values[i]);
+      }
+
+      heads[tile] = head;
+      sums[tile]  = sum;
+    }
+  }
+};
+
+
+// reduces the segments of one tile, starting the first from the tile's carry
+// and leaving out the last when it runs on into the next tile
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename ValueType,
+         typename Size,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+struct reduce_tile
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type KeyType;
+
+  InputIterator1                                         keys;
+  InputIterator2                                         values;
+  OutputIterator1                                        keys_output;
+  OutputIterator2                                        values_output;
+  Size                                                   n;
+  uniform_decomposition<Size>                            tiles;
+  thrust::detail::wrapped_function<BinaryPredicate,bool> binary_pred;
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> binary_op;
+  const Size                                            *offsets;
+  const Size                                            *carry_heads;
+  const ValueType                                       *carries;
+  const bool                                            *has_carry;
+
+  reduce_tile(InputIterator1 keys,
+              InputIterator2 values,
+              OutputIterator1 keys_output,
+              OutputIterator2 values_output,
+              Size n,
+              uniform_decomposition<Size> tiles,
+              BinaryPredicate binary_pred,
+              BinaryFunction binary_op,
+              const Size *offsets,
+              const Size *carry_heads,
+              const ValueType *carries,
+              const bool *has_carry)
+    : keys(keys), values(values), keys_output(keys_output), values_output(values_output),
+      n(n), tiles(tiles), binary_pred(binary_pred), binary_op(binary_op),
+      offsets(offsets), carry_heads(carry_heads), carries(carries), has_carry(has_carry)
+  {}
+
+  void operator()(Size tile) const
+  {
+    index_range<Size> range = tiles[tile];
+
+    OutputIterator1 keys_result   = keys_output   + offsets[tile];
+    OutputIterator2 values_result = values_output + offsets[tile];
+
+    for(Size i = range.begin(); i < range.end();)
+    {
+      // the segment begins here, unless it is carried in from before the tile
+      const bool carried = (i == range.begin()) && has_carry[tile];
+
+      KeyType   key = keys[carried ? carry_heads[tile] : i];
+      ValueType sum = carried ? binary_op(carries[tile], values[i]) : ValueType(values[i]);
+
+      for(++i; i < range.end() && continues_segment(keys, i, binary_pred); ++i)
+      {
+        sum = binary_op(sum, values[i]);
+      }
+
+      // the next tile outputs the segment which runs on into it
+      if(i == range.end() && i < n && continues_segment(keys, i, binary_pred))
+        break;
+
+      *keys_result   = key;
+      *values_result = sum;
+
+      ++keys_result;
+      ++values_result;
+    }
+  }
+};
+
+
+} // end namespace reduce_by_key_detail
+
+
+// Reduces [values, values + n) by the segments of equivalent keys in
+// [keys, keys + n), split into num_tiles tiles. A first parallel pass counts
+// the segments which end in each tile and reduces the part of each tile's
+// last segment which runs on into the next tile. A sequential pass scans the
+// counts into output offsets and chains those partial reductions into one
+// carry per tile, and a second parallel pass reduces every tile seeded with
+// its carry. Temporary storage is proportional to num_tiles, and the output
+// is only ever written. for_each_tile(num_tiles, f) must invoke f(tile) for
+// every tile in [0, num_tiles), in any order and concurrently if it likes.
+template<typename DerivedPolicy,
+         typename ForEachTile,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename Size,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+thrust::pair<OutputIterator1,OutputIterator2>
+  parallel_reduce_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                         ForEachTile for_each_tile,
+                         InputIterator1 keys,
+                         InputIterator2 values,
+                         OutputIterator1 keys_output,
+                         OutputIterator2 values_output,
+                         Size n,
+                         Size num_tiles,
+                         BinaryPredicate binary_pred,
+                         BinaryFunction binary_op)
+{
+  using namespace reduce_by_key_detail;
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  typedef typename thrust::iterator_value<InputIterator2>::type ValueType;
+
+  uniform_decomposition<Size> tiles(n, 1, num_tiles);
+
+  thrust::detail::temporary_array<Size,DerivedPolicy>      indices(0, exec, 3 * tiles.size() + 1);
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> sums(exec, tiles.size());
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> carries(exec, tiles.size());
+  thrust::detail::temporary_array<bool,DerivedPolicy>      has_carry(0, exec, tiles.size());
+
+  // offsets[i] is the number of segments which end before tile i, heads[i]
+  // is where the part of tile i's last segment inside it begins, and
+  // carry_heads[i] is where the segment carried into tile i begins
+  Size      *offsets       = thrust::raw_pointer_cast(indices.data());
+  Size      *heads         = offsets + tiles.size() + 1;
+  Size      *carry_heads   = heads + tiles.size();
+  ValueType *sums_ptr      = thrust::raw_pointer_cast(sums.data());
+  ValueType *carries_ptr   = thrust::raw_pointer_cast(carries.data());
+  bool      *has_carry_ptr = thrust::raw_pointer_cast(has_carry.data());
+
+  for_each_tile(tiles.size(),
+                count_tile<InputIterator1,InputIterator2,ValueType,Size,BinaryPredicate,BinaryFunction>
+                  (keys, values, n, tiles, binary_pred, binary_op, offsets + 1, heads, sums_ptr));
+
+  thrust::detail::wrapped_function<BinaryPredicate,bool>     wrapped_binary_pred(binary_pred);
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  offsets[0]       = 0;
+  has_carry_ptr[0] = false;
+
+  for(Size i = 1; i < tiles.size(); ++i)
+  {
+    // a tile outputs nothing when a single segment runs through all of it
+    const bool passes_through = has_carry_ptr[i - 1] && offsets[i] == 0;
+
+    has_carry_ptr[i] = continues_segment(keys, tiles[i].begin(), wrapped_binary_pred);
+
+    if(has_carry_ptr[i])
+    {
+      if(passes_through)
+      {
+        carry_heads[i] = carry_heads[i - 1];
+        carries_ptr[i] = wrapped_binary_op(carries_ptr[i - 1], sums_ptr[i - 1]);
+      }
+      else
+      {
+        carry_heads[i] = heads[i - 1];
+        carries_ptr[i] = sums_ptr[i - 1];
+      }
+    }
+
+    offsets[i] += offsets[i - 1];
+  }
+
+  offsets[tiles.size()] += offsets[tiles.size() - 1];
+
+  for_each_tile(tiles.size(),
+                reduce_tile<InputIterator1,InputIterator2,OutputIterator1,OutputIterator2,ValueType,Size,BinaryPredicate,BinaryFunction>
+                  (keys, values, keys_output, values_output, n, tiles, binary_pred, binary_op,
+                   offsets, carry_heads, carries_ptr, has_carry_ptr));
+
+  const Size num_segments = offsets[tiles.size()];
+
+  return thrust::make_pair(keys_output + num_segments, values_output + num_segments);
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,223 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_scan.h
+ *  \brief Prefix sums, parallelized over tiles by a host backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/scan.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/parallel_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace scan_detail
+{
+
+
+// inclusive scan of tile i, which folds in the sum of all preceding tiles
+template<typename InputIterator,
+         typename OutputIterator,
+         typename CarryIterator,
+         typename BinaryFunction,
+         typename ValueType,
+         typename Size>
+struct inclusive_scan_tile
+{
+  InputIterator                                              input;
+  OutputIterator                                             output;
+  CarryIterator                                              sums;
+  uniform_decomposition<Size>                                tiles;
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> binary_op;
+
+  inclusive_scan_tile(InputIterator input,
+                      OutputIterator output,
+                      CarryIterator sums,
+                      uniform_decomposition<Size> tiles,
+                      BinaryFunction binary_op)
+    : input(input), output(output), sums(sums), tiles(tiles), binary_op(binary_op)
+  {}
+
+  void operator()(Size i) const
+  {
+    InputIterator  first  = input  + tiles[i].begin();
+    InputIterator  last   = input  + tiles[i].end();
+    OutputIterator result = output + tiles[i].begin();
+
+    // the first tile has no carry
+    ValueType carry = (i == 0) ? ValueType(*first) : binary_op(ValueType(sums[i - 1]), *first);
+
+    *result = carry;
+
+    for(++first, ++result; first != last; ++first, ++result)
+    {
+      *result = carry = binary_op(carry, *first);
+    }
+  }
+};
+
+
+// exclusive scan of tile i, seeded with the sum of init and all preceding tiles
+template<typename InputIterator,
+         typename OutputIterator,
+         typename CarryIterator,
+         typename BinaryFunction,
+         typename ValueType,
+         typename Size>
+struct exclusive_scan_tile
+{
+  InputIterator               input;
+  OutputIterator              output;
+  CarryIterator               carries;
+  uniform_decomposition<Size> tiles;
+  BinaryFunction              binary_op;
+
+  exclusive_scan_tile(InputIterator input,
+                      OutputIterator output,
+                      CarryIterator carries,
+                      uniform_decomposition<Size> tiles,
+                      BinaryFunction binary_op)
+    : input(input), output(output), carries(carries), tiles(tiles), binary_op(binary_op)
+  {}
+
+  void operator()(Size i) const
+  {
+    thrust::exclusive_scan(thrust::seq,
+                           input + tiles[i].begin(),
+                           input + tiles[i].end(),
+                           output + tiles[i].begin(),
+                           static_cast<ValueType>(carries[i]),
+                           binary_op);
+  }
+};
+
+
+} // end namespace scan_detail
+
+
+// Inclusive scan of [first, first + n) into result, split into num_tiles
+// tiles. A first parallel pass reduces every tile but the last, a sequential
+// pass scans those sums into each tile's carry, and a second parallel pass
+// scans every tile seeded with its carry. for_each_tile(num_tiles, f) must
+// invoke f(tile) for every tile in [0, num_tiles), in any order and
+// concurrently if it likes.
+template<typename DerivedPolicy,
+         typename ForEachTile,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename BinaryFunction>
+OutputIterator parallel_inclusive_scan(thrust::execution_policy<DerivedPolicy> &exec,
+                                       ForEachTile for_each_tile,
+                                       InputIterator first,
+                                       OutputIterator result,
+                                       Size n,
+                                       Size num_tiles,
+                                       BinaryFunction binary_op)
+{
+  using namespace scan_detail;
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  typedef typename thrust::iterator_value<InputIterator>::type ValueType;
+
+  uniform_decomposition<Size> tiles(n, 1, num_tiles);
+
+  // sums[i] holds the reduction of tiles [0, i]
+  // the final tile's sum is never consumed, so don't reserve space for it
+  typedef thrust::detail::temporary_array<ValueType,DerivedPolicy> sums_type;
+  sums_type sums(exec, tiles.size() - 1);
+
+  for_each_tile(tiles.size() - 1,
+                reduce_detail::reduce_tile<InputIterator,typename sums_type::iterator,BinaryFunction,ValueType,Size>
+                  (first, sums.begin(), Size(0), tiles, binary_op));
+
+  thrust::inclusive_scan(thrust::seq, sums.begin(), sums.end(), sums.begin(), binary_op);
+
+  for_each_tile(tiles.size(),
+                inclusive_scan_tile<InputIterator,OutputIterator,typename sums_type::iterator,BinaryFunction,ValueType,Size>
+                  (first, result, sums.begin(), tiles, binary_op));
+
+  return result + n;
+}
+
+
+// Exclusive scan of [first, first + n) into result, seeded with init, in the
+// same passes as parallel_inclusive_scan.
+template<typename DerivedPolicy,
+         typename ForEachTile,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename T,
+         typename BinaryFunction>
+OutputIterator parallel_exclusive_scan(thrust::execution_policy<DerivedPolicy> &exec,
+                                       ForEachTile for_each_tile,
+                                       InputIterator first,
+                                       OutputIterator result,
+                                       Size n,
+                                       Size num_tiles,
+                                       T init,
+                                       BinaryFunction binary_op)
+{
+  using namespace scan_detail;
+
+  uniform_decomposition<Size> tiles(n, 1, num_tiles);
+
+  // carries[0] holds init and carries[i + 1] the reduction of init and tiles
+  // [0, i]; the final tile's sum is never consumed, so don't reserve space
+  // for it
+  typedef thrust::detail::temporary_array<T,DerivedPolicy> carries_type;
+  carries_type carries(exec, tiles.size());
+
+  carries[0] = init;
+
+  for_each_tile(tiles.size() - 1,
+                reduce_detail::reduce_tile<InputIterator,typename carries_type::iterator,BinaryFunction,T,Size>
+                  (first, carries.begin(), Size(1), tiles, binary_op));
+
+  thrust::inclusive_scan(thrust::seq, carries.begin(), carries.end(), carries.begin(), binary_op);
+
+  for_each_tile(tiles.size(),
+                exclusive_scan_tile<InputIterator,OutputIterator,typename carries_type::iterator,BinaryFunction,T,Size>
+                  (first, result, carries.begin(), tiles, binary_op));
+
+  return result + n;
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,405 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_scan_by_key.h
+ *  \brief Segmented scans, parallelized over tiles by a host backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace scan_by_key_detail
+{
+
+
+// true iff keys[i] belongs to the same segment as keys[i - 1]
+template<typename InputIterator1, typename Size, typename BinaryPredicate>
+bool continues_segment(InputIterator1 keys, Size i, const BinaryPredicate &binary_pred)
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type KeyType;
+
+  KeyType prev_key = keys[i - 1];
+  KeyType key      = keys[i];
+
+  return binary_pred(prev_key, key);
+}
+
+
+// Reduces the values of the segment which a tile ends in, from its first
+// element inside the tile to the end of the tile, and records whether that
+// segment covers the whole tile.
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename AccumType,
+         typename Size,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+struct reduce_last_segment
+{
+  InputIterator1                                       keys;
+  InputIterator2                                       values;
+  uniform_decomposition<Size>                          tiles;
+  thrust::detail::wrapped_function<BinaryPredicate,bool> binary_pred;
+  thrust::detail::wrapped_function<BinaryFunction,AccumType> binary_op;
+  AccumType                                           *sums;
+  bool                                                *whole;
+
+  reduce_last_segment(InputIterator1 keys,
+                      InputIterator2 values,
+                      uniform_decomposition<Size> tiles,
+                      BinaryPredicate binary_pred,
+                      BinaryFunction binary_op,
+                      AccumType *sums,
+                      bool *whole)
+    : keys(keys), values(values), tiles(tiles),
+      binary_pred(binary_pred), binary_op(binary_op),
+      sums(sums), whole(whole)
+  {}
+
+  void operator()(Size tile) const
+  {
+    index_range<Size> range = tiles[tile];
+
+    // walk back to the head of the last segment
+    Size head = range.end() - 1;
+
+    while(head > range.begin() && continues_segment(keys, head, binary_pred))
+    {
+      --head;
+    }
+
+    AccumType sum = values[head];
+
+    for(Size i = head + 1; i < range.end(); ++i)
+    {
+      sum = binary_op(sum, values[i]);
+    }
+
+    sums[tile]  = sum;
+    whole[tile] = (head == range.begin());
+  }
+};
+
+
+// Turns the reductions of the tiles' last segments into the carry each tile
+// receives from the tiles before it: tile i has a carry iff its first key
+// continues the segment of the key before it, and that carry spans every
+// preceding tile which the segment covers completely.
+template<typename InputIterator1,
+         typename AccumType,
+         typename Size,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+void propagate_carries(InputIterator1 keys,
+                       uniform_decomposition<Size> tiles,
+                       BinaryPredicate binary_pred,
+                       BinaryFunction binary_op,
+                       const AccumType *sums,
+                       const bool *whole,
+                       AccumType *carries,
+                       bool *has_carry)
+{
+  thrust::detail::wrapped_function<BinaryPredicate,bool>     wrapped_binary_pred(binary_pred);
+  thrust::detail::wrapped_function<BinaryFunction,AccumType> wrapped_binary_op(binary_op);
+
+  has_carry[0] = false;
+
+  for(Size i = 1; i < tiles.size(); ++i)
+  {
+    Size begin = tiles[i].begin();
+
+    has_carry[i] = continues_segment(keys, begin, wrapped_binary_pred);
+
+    if(has_carry[i])
+    {
+      if(whole[i - 1] && has_carry[i - 1])
+      {
+        carries[i] = wrapped_binary_op(carries[i - 1], sums[i - 1]);
+      }
+      else
+      {
+        carries[i] = sums[i - 1];
+      }
+    }
+  }
+}
+
+
+// scans one tile, folding its carry into its first segment
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename ValueType,
+         typename Size,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+struct inclusive_scan_tile
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type KeyType;
+
+  InputIterator1                                       keys;
+  InputIterator2                                       values;
+  OutputIterator                                       result;
+  uniform_decomposition<Size>                          tiles;
+  thrust::detail::wrapped_function<BinaryPredicate,bool> binary_pred;
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> binary_op;
+  const ValueType                                     *carries;
+  const bool                                          *has_carry;
+
+  inclusive_scan_tile(InputIterator1 keys,
+                      InputIterator2 values,
+                      OutputIterator result,
+                      uniform_decomposition<Size> tiles,
+                      BinaryPredicate binary_pred,
+                      BinaryFunction binary_op,
+                      const ValueType *carries,
+                      const bool *has_carry)
+    : keys(keys), values(values), result(result), tiles(tiles),
+      binary_pred(binary_pred), binary_op(binary_op),
+      carries(carries), has_carry(has_carry)
+  {}
+
+  void operator()(Size tile) const
+  {
+    index_range<Size> range = tiles[tile];
+
+    Size i = range.begin();
+
+    // the keys are read ahead of the writes to permit in-place scans
+    KeyType prev_key = keys[i];
+
+    ValueType sum = has_carry[tile] ? binary_op(carries[tile], values[i]) : ValueType(values[i]);
+
+    result[i] = sum;
+
+    for(++i; i < range.end(); ++i)
+    {
+      KeyType key = keys[i];
+
+      if(binary_pred(prev_key, key))
+      {
+        sum = binary_op(sum, values[i]);
+      }
+      else
+      {
+        sum = values[i];
+      }
+
+      result[i] = sum;
+      prev_key  = key;
+    }
+  }
+};
+
+
+// scans one tile, folding its carry into its first segment
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename T,
+         typename Size,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+struct exclusive_scan_tile
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type KeyType;
+
+  InputIterator1                               keys;
+  InputIterator2                               values;
+  OutputIterator                               result;
+  T                                            init;
+  uniform_decomposition<Size>                  tiles;
+  thrust::detail::wrapped_function<BinaryPredicate,bool> binary_pred;
+  thrust::detail::wrapped_function<BinaryFunction,T> binary_op;
+  const T                                     *carries;
+  const bool                                  *has_carry;
+
+  exclusive_scan_tile(InputIterator1 keys,
+                      InputIterator2 values,
+                      OutputIterator result,
+                      T init,
+                      uniform_decomposition<Size> tiles,
+                      BinaryPredicate binary_pred,
+                      BinaryFunction binary_op,
+                      const T *carries,
+                      const bool *has_carry)
+    : keys(keys), values(values), result(result), init(init), tiles(tiles),
+      binary_pred(binary_pred), binary_op(binary_op),
+      carries(carries), has_carry(has_carry)
+  {}
+
+  void operator()(Size tile) const
+  {
+    index_range<Size> range = tiles[tile];
+
+    T next = has_carry[tile] ? binary_op(init, carries[tile]) : init;
+
+    // use temps to permit in-place scans
+    KeyType prev_key = keys[range.begin()];
+
+    for(Size i = range.begin(); i < range.end(); ++i)
+    {
+      KeyType key        = keys[i];
+      T       temp_value = values[i];
+
+      if(i != range.begin() && !binary_pred(prev_key, key))
+      {
+        next = init; // reset sum
+      }
+
+      result[i] = next;
+
+      next     = binary_op(next, temp_value);
+      prev_key = key;
+    }
+  }
+};
+
+
+} // end namespace scan_by_key_detail
+
+
+// Segmented scans of [values, values + n) by the keys [keys, keys + n), split
+// into num_tiles tiles. A first parallel pass reduces the segment each tile
+// ends in, a sequential pass turns those into one (flag, value) carry per
+// tile, and a second parallel pass scans every tile seeded with its carry.
+// The first pass only touches the last segment of each tile, so the values
+// are traversed about once. for_each_tile(num_tiles, f) must invoke f(tile)
+// for every tile in [0, num_tiles), in any order and concurrently if it likes.
+template<typename DerivedPolicy,
+         typename ForEachTile,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename Size,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+OutputIterator parallel_inclusive_scan_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                                              ForEachTile for_each_tile,
+                                              InputIterator1 keys,
+                                              InputIterator2 values,
+                                              OutputIterator result,
+                                              Size n,
+                                              Size num_tiles,
+                                              BinaryPredicate binary_pred,
+                                              BinaryFunction binary_op)
+{
+  using namespace scan_by_key_detail;
+
+  // match the accumulator of the sequential inclusive_scan_by_key
+  typedef typename thrust::iterator_traits<InputIterator2>::value_type ValueType;
+
+  uniform_decomposition<Size> tiles(n, 1, num_tiles);
+
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> sums(exec, tiles.size());
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> carries(exec, tiles.size());
+  thrust::detail::temporary_array<bool,DerivedPolicy>      flags(0, exec, 2 * tiles.size());
+
+  ValueType *sums_ptr      = thrust::raw_pointer_cast(sums.data());
+  ValueType *carries_ptr   = thrust::raw_pointer_cast(carries.data());
+  bool      *whole_ptr     = thrust::raw_pointer_cast(flags.data());
+  bool      *has_carry_ptr = whole_ptr + tiles.size();
+
+  // the last tile has no successor to carry into
+  for_each_tile(tiles.size() - 1,
+                reduce_last_segment<InputIterator1,InputIterator2,ValueType,Size,BinaryPredicate,BinaryFunction>
+                  (keys, values, tiles, binary_pred, binary_op, sums_ptr, whole_ptr));
+
+  propagate_carries(keys, tiles, binary_pred, binary_op, sums_ptr, whole_ptr, carries_ptr, has_carry_ptr);
+
+  for_each_tile(tiles.size(),
+                inclusive_scan_tile<InputIterator1,InputIterator2,OutputIterator,ValueType,Size,BinaryPredicate,BinaryFunction>
+                  (keys, values, result, tiles, binary_pred, binary_op, carries_ptr, has_carry_ptr));
+
+  return result + n;
+}
+
+
+template<typename DerivedPolicy,
+         typename ForEachTile,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename Size,
+         typename T,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+OutputIterator parallel_exclusive_scan_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                                              ForEachTile for_each_tile,
+                                              InputIterator1 keys,
+                                              InputIterator2 values,
+                                              OutputIterator result,
+                                              Size n,
+                                              Size num_tiles,
+                                              T init,
+                                              BinaryPredicate binary_pred,
+                                              BinaryFunction binary_op)
+{
+  using namespace scan_by_key_detail;
+
+  uniform_decomposition<Size> tiles(n, 1, num_tiles);
+
+  // the carries exclude init, which each segment applies once
+  thrust::detail::temporary_array<T,DerivedPolicy>    sums(exec, tiles.size());
+  thrust::detail::temporary_array<T,DerivedPolicy>    carries(exec, tiles.size());
+  thrust::detail::temporary_array<bool,DerivedPolicy> flags(0, exec, 2 * tiles.size());
+
+  T    *sums_ptr      = thrust::raw_pointer_cast(sums.data());
+  T    *carries_ptr   = thrust::raw_pointer_cast(carries.data());
+  bool *whole_ptr     = thrust::raw_pointer_cast(flags.data());
+  bool *has_carry_ptr = whole_ptr + tiles.size();
+
+  // the last tile has no successor to carry into
+  for_each_tile(tiles.size() - 1,
+                reduce_last_segment<InputIterator1,InputIterator2,T,Size,BinaryPredicate,BinaryFunction>
+                  (keys, values, tiles, binary_pred, binary_op, sums_ptr, whole_ptr));
+
+  propagate_carries(keys, tiles, binary_pred, binary_op, sums_ptr, whole_ptr, carries_ptr, has_carry_ptr);
+
+  for_each_tile(tiles.size(),
+                exclusive_scan_tile<InputIterator1,InputIterator2,OutputIterator,T,Size,BinaryPredicate,BinaryFunction>
+                  (keys, values, result, init, tiles, binary_pred, binary_op, carries_ptr, has_carry_ptr));
+
+  return result + n;
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
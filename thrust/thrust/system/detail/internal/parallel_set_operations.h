@@ -0,0 +1,267 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_set_operations.h
+ *  \brief Set operations on sorted ranges, parallelized over tiles by a host
+ *         backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/set_operations.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace set_operations_detail
+{
+
+
+// the sequential set operations run on each tile
+
+struct serial_set_difference
+{
+  template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result, StrictWeakOrdering comp) const
+  {
+    return thrust::set_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+
+struct serial_set_intersection
+{
+  template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result, StrictWeakOrdering comp) const
+  {
+    return thrust::set_intersection(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+
+struct serial_set_symmetric_difference
+{
+  template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result, StrictWeakOrdering comp) const
+  {
+    return thrust::set_symmetric_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+
+struct serial_set_union
+{
+  template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result, StrictWeakOrdering comp) const
+  {
+    return thrust::set_union(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+
+// cuts both inputs where tile begins
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+struct find_cuts
+{
+  RandomAccessIterator1       first1;
+  Size                        n1;
+  RandomAccessIterator2       first2;
+  Size                        n2;
+  uniform_decomposition<Size> tiles;
+  StrictWeakOrdering          comp;
+  Size                       *cuts1;
+  Size                       *cuts2;
+
+  find_cuts(RandomAccessIterator1 first1, Size n1,
+            RandomAccessIterator2 first2, Size n2,
+            uniform_decomposition<Size> tiles,
+            StrictWeakOrdering comp,
+            Size *cuts1, Size *cuts2)
+    : first1(first1), n1(n1), first2(first2), n2(n2),
+      tiles(tiles), comp(comp), cuts1(cuts1), cuts2(cuts2)
+  {}
+
+  void operator()(Size tile) const
+  {
+    thrust::pair<Size,Size> cut = set_operation_path(first1, n1, first2, n2, tiles[tile].begin(), comp);
+
+    cuts1[tile] = cut.first;
+    cuts2[tile] = cut.second;
+  }
+};
+
+
+// counts the output of one tile, storing it in sizes[tile]
+template<typename SetOperation, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+struct count_tile
+{
+  SetOperation          op;
+  RandomAccessIterator1 first1;
+  RandomAccessIterator2 first2;
+  const Size           *cuts1;
+  const Size           *cuts2;
+  StrictWeakOrdering    comp;
+  Size                 *sizes;
+
+  count_tile(SetOperation op,
+             RandomAccessIterator1 first1, RandomAccessIterator2 first2,
+             const Size *cuts1, const Size *cuts2,
+             StrictWeakOrdering comp,
+             Size *sizes)
+    : op(op), first1(first1), first2(first2), cuts1(cuts1), cuts2(cuts2), comp(comp), sizes(sizes)
+  {}
+
+  void operator()(Size tile) const
+  {
+    thrust::discard_iterator<> result;
+
+    sizes[tile] = op(first1 + cuts1[tile], first1 + cuts1[tile + 1],
+                     first2 + cuts2[tile], first2 + cuts2[tile + 1],
+                     result, comp) - result;
+  }
+};
+
+
+// writes the output of one tile, starting at offsets[tile]
+template<typename SetOperation, typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3, typename Size, typename StrictWeakOrdering>
+struct emit_tile
+{
+  SetOperation          op;
+  RandomAccessIterator1 first1;
+  RandomAccessIterator2 first2;
+  RandomAccessIterator3 result;
+  const Size           *cuts1;
+  const Size           *cuts2;
+  const Size           *offsets;
+  StrictWeakOrdering    comp;
+
+  emit_tile(SetOperation op,
+            RandomAccessIterator1 first1, RandomAccessIterator2 first2,
+            RandomAccessIterator3 result,
+            const Size *cuts1, const Size *cuts2, const Size *offsets,
+            StrictWeakOrdering comp)
+    : op(op), first1(first1), first2(first2), result(result),
+      cuts1(cuts1), cuts2(cuts2), offsets(offsets), comp(comp)
+  {}
+
+  void operator()(Size tile) const
+  {
+    op(first1 + cuts1[tile], first1 + cuts1[tile + 1],
+       first2 + cuts2[tile], first2 + cuts2[tile + 1],
+       result + offsets[tile], comp);
+  }
+};
+
+
+} // end namespace set_operations_detail
+
+
+// Applies the sequential set operation op to [first1, first1 + n1) and
+// [first2, first2 + n2) split into num_tiles independent pieces of about equal
+// size. Both inputs are cut at the same points so that runs of equivalent
+// elements stay whole, each tile counts its output, the counts are scanned,
+// and each tile then writes its output directly to its place in result.
+// for_each_tile(num_tiles, f) must invoke f(tile) for every tile in
+// [0, num_tiles), in any order and concurrently if it likes.
+template<typename DerivedPolicy,
+         typename ForEachTile,
+         typename SetOperation,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename Size,
+         typename StrictWeakOrdering>
+RandomAccessIterator3 parallel_set_operation(thrust::execution_policy<DerivedPolicy> &exec,
+                                             ForEachTile for_each_tile,
+                                             SetOperation op,
+                                             RandomAccessIterator1 first1,
+                                             Size n1,
+                                             RandomAccessIterator2 first2,
+                                             Size n2,
+                                             RandomAccessIterator3 result,
+                                             Size num_tiles,
+                                             StrictWeakOrdering comp)
+{
+  using namespace set_operations_detail;
+
+  uniform_decomposition<Size> tiles(n1 + n2, 1, num_tiles);
+
+  // cuts[tile] is where tile begins; cuts[tiles.size()] is the end of the input
+  thrust::detail::temporary_array<Size,DerivedPolicy> cuts1(0, exec, tiles.size() + 1);
+  thrust::detail::temporary_array<Size,DerivedPolicy> cuts2(0, exec, tiles.size() + 1);
+
+  // offsets[tile] is where tile writes its output; offsets[tiles.size()] is the size of the result
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets(0, exec, tiles.size() + 1);
+
+  Size *cuts1_ptr   = thrust::raw_pointer_cast(cuts1.data());
+  Size *cuts2_ptr   = thrust::raw_pointer_cast(cuts2.data());
+  Size *offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  for_each_tile(tiles.size(),
+                find_cuts<RandomAccessIterator1,RandomAccessIterator2,Size,StrictWeakOrdering>
+                  (first1, n1, first2, n2, tiles, comp, cuts1_ptr, cuts2_ptr));
+
+  cuts1_ptr[tiles.size()] = n1;
+  cuts2_ptr[tiles.size()] = n2;
+
+  for_each_tile(tiles.size(),
+                count_tile<SetOperation,RandomAccessIterator1,RandomAccessIterator2,Size,StrictWeakOrdering>
+                  (op, first1, first2, cuts1_ptr, cuts2_ptr, comp, offsets_ptr + 1));
+
+  offsets_ptr[0] = 0;
+  thrust::inclusive_scan(thrust::seq, offsets_ptr + 1, offsets_ptr + tiles.size() + 1, offsets_ptr + 1);
+
+  for_each_tile(tiles.size(),
+                emit_tile<SetOperation,RandomAccessIterator1,RandomAccessIterator2,RandomAccessIterator3,Size,StrictWeakOrdering>
+                  (op, first1, first2, result, cuts1_ptr, cuts2_ptr, offsets_ptr, comp));
+
+  return result + offsets_ptr[tiles.size()];
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,210 @@
+/*
+ *  Copyright 2008-2020 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_shuffle.h
+ *  \brief Shuffling copy, parallelized over tiles by a host backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp11_required.h>
+
+#if _CCCL_STD_VER >= 2011
+
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace shuffle_detail
+{
+
+
+// Evaluates the bijection over one tile of its domain and packs the values
+// below m, in order, at the front of the tile's span of keys.
+template<typename Key, typename Size>
+struct select_keys_tile
+{
+  thrust::system::detail::generic::feistel_bijection bijection;
+  std::uint64_t                                      m;
+  uniform_decomposition<Size>                        tiles;
+  Key                                               *keys;
+  Size                                              *counts;
+
+  select_keys_tile(thrust::system::detail::generic::feistel_bijection bijection,
+                   std::uint64_t m,
+                   uniform_decomposition<Size> tiles,
+                   Key *keys,
+                   Size *counts)
+    : bijection(bijection), m(m), tiles(tiles), keys(keys), counts(counts)
+  {}
+
+  void operator()(Size tile) const
+  {
+    index_range<Size> range = tiles[tile];
+
+    Key *result = keys + range.begin();
+
+    Size count = 0;
+
+    for(Size i = range.begin(); i < range.end(); ++i)
+    {
+      const std::uint64_t key = bijection(static_cast<std::uint64_t>(i));
+
+      // store unconditionally and advance only past keys in range
+      result[count] = static_cast<Key>(key);
+      count += key < m;
+    }
+
+    counts[tile] = count;
+  }
+};
+
+
+// gathers the elements named by one tile's keys to where the tile's output
+// begins
+template<typename Key, typename RandomIterator, typename OutputIterator, typename Size>
+struct gather_tile
+{
+  RandomIterator               first;
+  OutputIterator               result;
+  uniform_decomposition<Size>  tiles;
+  const Key                   *keys;
+  const Size                  *offsets;
+
+  gather_tile(RandomIterator first,
+              OutputIterator result,
+              uniform_decomposition<Size> tiles,
+              const Key *keys,
+              const Size *offsets)
+    : first(first), result(result), tiles(tiles), keys(keys), offsets(offsets)
+  {}
+
+  void operator()(Size tile) const
+  {
+    const Key *tile_keys = keys + tiles[tile].begin();
+
+    const Size count = offsets[tile + 1] - offsets[tile];
+
+    OutputIterator out = result + offsets[tile];
+
+    for(Size j = 0; j < count; ++j)
+    {
+      out[j] = first[tile_keys[j]];
+    }
+  }
+};
+
+
+template<typename Key,
+         typename DerivedPolicy,
+         typename ForEachTile,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename Size>
+void parallel_shuffle_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                           ForEachTile for_each_tile,
+                           RandomIterator first,
+                           Size m,
+                           OutputIterator result,
+                           const thrust::system::detail::generic::feistel_bijection &bijection,
+                           Size num_tiles)
+{
+  const Size n = static_cast<Size>(bijection.nearest_power_of_two());
+
+  uniform_decomposition<Size> tiles(n, 1, num_tiles);
+
+  // each tile's selected keys, packed at the front of its span of the domain
+  thrust::detail::temporary_array<Key,DerivedPolicy> keys(exec, n);
+  Key *raw_keys = thrust::raw_pointer_cast(keys.data());
+
+  // offsets[i] is the number of selected keys preceding tile i
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets(0, exec, tiles.size() + 1);
+  Size *raw_offsets = thrust::raw_pointer_cast(offsets.data());
+
+  for_each_tile(tiles.size(), select_keys_tile<Key,Size>(bijection, m, tiles, raw_keys, raw_offsets + 1));
+
+  raw_offsets[0] = 0;
+
+  for(Size i = 0; i < tiles.size(); ++i)
+  {
+    raw_offsets[i + 1] += raw_offsets[i];
+  }
+
+  for_each_tile(tiles.size(), gather_tile<Key,RandomIterator,OutputIterator,Size>(first, result, tiles, raw_keys, raw_offsets));
+}
+
+
+} // end namespace shuffle_detail
+
+
+// Copies [first, first + m) to [result, result + m) in the order of
+// bijection, split into num_tiles tiles of its domain: the same permutation
+// generic::shuffle_copy computes, so that every system shuffles alike for the
+// same random engine. A first parallel pass evaluates the bijection once per
+// point of its domain and packs the values below m of each tile, a scan of
+// the tiles' counts places their output, and a second parallel pass gathers.
+// The keys are 32 bits wide whenever the domain allows. for_each_tile(
+// num_tiles, f) must invoke f(tile) for every tile in [0, num_tiles), in any
+// order and concurrently if it likes.
+template<typename DerivedPolicy,
+         typename ForEachTile,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename Size>
+void parallel_shuffle_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                           ForEachTile for_each_tile,
+                           RandomIterator first,
+                           Size m,
+                           OutputIterator result,
+                           const thrust::system::detail::generic::feistel_bijection &bijection,
+                           Size num_tiles)
+{
+  if(bijection.nearest_power_of_two() <= (std::uint64_t(1) << 32))
+  {
+    shuffle_detail::parallel_shuffle_copy<std::uint32_t>(exec, for_each_tile, first, m, result, bijection, num_tiles);
+  }
+  else
+  {
+    shuffle_detail::parallel_shuffle_copy<std::uint64_t>(exec, for_each_tile, first, m, result, bijection, num_tiles);
+  }
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#endif
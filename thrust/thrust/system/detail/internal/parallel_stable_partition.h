@@ -0,0 +1,288 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file parallel_stable_partition.h
+ *  \brief In-place stable partitioning, parallelized over tiles by a host backend
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace stable_partition_detail
+{
+
+
+// counts the elements of one tile which fail pred
+template<typename InputIterator, typename Size, typename Predicate>
+struct count_false_tile
+{
+  InputIterator                                    stencil;
+  uniform_decomposition<Size>                      tiles;
+  thrust::detail::wrapped_function<Predicate,bool> pred;
+  Size                                            *counts;
+
+  count_false_tile(InputIterator stencil, uniform_decomposition<Size> tiles, Predicate pred, Size *counts)
+    : stencil(stencil), tiles(tiles), pred(pred), counts(counts)
+  {}
+
+  void operator()(Size tile) const
+  {
+    index_range<Size> range = tiles[tile];
+
+    Size count = 0;
+
+    for(Size i = range.begin(); i < range.end(); ++i)
+    {
+      if(!pred(stencil[i]))
+      {
+        ++count;
+      }
+    }
+
+    counts[tile] = count;
+  }
+};
+
+
+// Moves the true elements of one tile to the front of the tile and its false
+// elements to their final place in the buffer, both in their original order.
+// The trues only ever move towards the front of their own tile, so the stencil
+// may alias the input.
+template<typename RandomAccessIterator,
+         typename InputIterator,
+         typename T,
+         typename Size,
+         typename Predicate>
+struct split_tile
+{
+  RandomAccessIterator                             first;
+  InputIterator                                    stencil;
+  T                                               *falses;
+  const Size                                      *false_offsets;
+  uniform_decomposition<Size>                      tiles;
+  thrust::detail::wrapped_function<Predicate,bool> pred;
+
+  split_tile(RandomAccessIterator first,
+             InputIterator stencil,
+             T *falses,
+             const Size *false_offsets,
+             uniform_decomposition<Size> tiles,
+             Predicate pred)
+    : first(first), stencil(stencil), falses(falses), false_offsets(false_offsets),
+      tiles(tiles), pred(pred)
+  {}
+
+  void operator()(Size tile) const
+  {
+    index_range<Size> range = tiles[tile];
+
+    Size true_result  = range.begin();
+    T   *false_result = falses + false_offsets[tile];
+
+    for(Size i = range.begin(); i < range.end(); ++i)
+    {
+      if(pred(stencil[i]))
+      {
+        if(true_result != i)
+        {
+          first[true_result] = first[i];
+        }
+
+        ++true_result;
+      }
+      else
+      {
+        *false_result = first[i];
+        ++false_result;
+      }
+    }
+  }
+};
+
+
+// Joins pairs of neighbouring groups of width tiles, whose true elements sit
+// at the front of each group, by moving the trues of the right group down
+// onto the end of the trues of the left group. The destination never lies
+// after the source, so a forward copy is safe.
+template<typename RandomAccessIterator, typename Size>
+struct join_groups
+{
+  RandomAccessIterator         first;
+  uniform_decomposition<Size>  tiles;
+  const Size                  *true_offsets;
+  Size                         width;
+
+  join_groups(RandomAccessIterator first,
+              uniform_decomposition<Size> tiles,
+              const Size *true_offsets,
+              Size width)
+    : first(first), tiles(tiles), true_offsets(true_offsets), width(width)
+  {}
+
+  void operator()(Size pair) const
+  {
+    const Size left  = 2 * width * pair;
+    const Size right = left + width;
+    const Size end   = thrust::min<Size>(right + width, tiles.size());
+
+    Size src = tiles[right].begin();
+    Size dst = tiles[left].begin() + (true_offsets[right] - true_offsets[left]);
+
+    const Size src_end = src + (true_offsets[end] - true_offsets[right]);
+
+    if(src == dst)
+      return;
+
+    for(; src < src_end; ++src, ++dst)
+    {
+      first[dst] = first[src];
+    }
+  }
+};
+
+
+// copies one tile of the buffered false elements back behind the trues
+template<typename T, typename RandomAccessIterator, typename Size>
+struct copy_back_tile
+{
+  const T                     *falses;
+  RandomAccessIterator         result;
+  uniform_decomposition<Size>  tiles;
+
+  copy_back_tile(const T *falses, RandomAccessIterator result, uniform_decomposition<Size> tiles)
+    : falses(falses), result(result), tiles(tiles)
+  {}
+
+  void operator()(Size tile) const
+  {
+    index_range<Size> range = tiles[tile];
+
+    for(Size i = range.begin(); i < range.end(); ++i)
+    {
+      result[i] = falses[i];
+    }
+  }
+};
+
+
+} // end namespace stable_partition_detail
+
+
+// Stably partitions [first, first + n) in place by pred applied to
+// [stencil, stencil + n), split into num_tiles tiles, and returns the end of
+// the true partition. Only the false elements are buffered: a first parallel
+// pass counts them, a second moves the trues of each tile to the front of the
+// tile and the falses to the buffer, log2(num_tiles) parallel rounds join the
+// runs of trues pairwise, and a last parallel pass copies the falses back.
+// The stencil may alias first. for_each_tile(num_tiles, f) must invoke
+// f(tile) for every tile in [0, num_tiles), in any order and concurrently if
+// it likes.
+template<typename DerivedPolicy,
+         typename ForEachTile,
+         typename RandomAccessIterator,
+         typename InputIterator,
+         typename Size,
+         typename Predicate>
+RandomAccessIterator parallel_stable_partition(thrust::execution_policy<DerivedPolicy> &exec,
+                                               ForEachTile for_each_tile,
+                                               RandomAccessIterator first,
+                                               InputIterator stencil,
+                                               Size n,
+                                               Size num_tiles,
+                                               Predicate pred)
+{
+  using namespace stable_partition_detail;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type T;
+
+  uniform_decomposition<Size> tiles(n, 1, num_tiles);
+
+  // offsets[i] and offsets[tiles.size() + 1 + i] are the numbers of false and
+  // true elements preceding tile i
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets(0, exec, 2 * (tiles.size() + 1));
+
+  Size *false_offsets = thrust::raw_pointer_cast(offsets.data());
+  Size *true_offsets  = false_offsets + tiles.size() + 1;
+
+  for_each_tile(tiles.size(), count_false_tile<InputIterator,Size,Predicate>(stencil, tiles, pred, false_offsets + 1));
+
+  false_offsets[0] = 0;
+  true_offsets[0]  = 0;
+
+  for(Size i = 0; i < tiles.size(); ++i)
+  {
+    const Size num_false = false_offsets[i + 1];
+
+    false_offsets[i + 1] = false_offsets[i] + num_false;
+    true_offsets[i + 1]  = true_offsets[i] + tiles[i].size() - num_false;
+  }
+
+  const Size num_true  = true_offsets[tiles.size()];
+  const Size num_false = n - num_true;
+
+  thrust::detail::temporary_array<T,DerivedPolicy> falses(exec, num_false);
+  T *falses_ptr = thrust::raw_pointer_cast(falses.data());
+
+  for_each_tile(tiles.size(),
+                split_tile<RandomAccessIterator,InputIterator,T,Size,Predicate>
+                  (first, stencil, falses_ptr, false_offsets, tiles, pred));
+
+  for(Size width = 1; width < tiles.size(); width *= 2)
+  {
+    // the groups at the end without a right neighbour stay where they are
+    const Size num_pairs = (tiles.size() + width - 1) / (2 * width);
+
+    for_each_tile(num_pairs, join_groups<RandomAccessIterator,Size>(first, tiles, true_offsets, width));
+  }
+
+  if(num_false > 0)
+  {
+    uniform_decomposition<Size> false_tiles(num_false, 1, num_tiles);
+
+    for_each_tile(false_tiles.size(), copy_back_tile<T,RandomAccessIterator,Size>(falses_ptr, first + num_true, false_tiles));
+  }
+
+  return first + num_true;
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
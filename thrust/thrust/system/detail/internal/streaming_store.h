@@ -0,0 +1,170 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file streaming_store.h
+ *  \brief Copies and fills of raw memory whose stores may bypass the caches
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// non-temporal stores are only issued where SSE2 is known to be available
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define THRUST_HAS_SSE2_STREAMING_STORES 1
+#  include <emmintrin.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// Copies and fills of more bytes than this don't fit in the last level cache
+// of most hosts, so caching what they store would only evict everything else
+// without being read back from the cache.
+const static std::size_t streaming_store_threshold = 32 * 1024 * 1024;
+
+// the blocks which threads copy or fill in parallel begin on cache lines of
+// the destination, so that no two threads store to the same line
+const static std::size_t cache_line_size = 64;
+
+
+// the first offset at or after offset from base which begins a cache line,
+// but no further than size; 0 and size are edges themselves
+inline std::size_t cache_line_edge(const void *base, std::size_t offset, std::size_t size)
+{
+  if(offset == 0)
+  {
+    return 0;
+  }
+
+  const std::size_t misalignment = (reinterpret_cast<std::uintptr_t>(base) + offset) % cache_line_size;
+
+  const std::size_t result = misalignment == 0 ? offset : offset + (cache_line_size - misalignment);
+
+  return result < size ? result : size;
+}
+
+
+// copies bytes from src to dst, which don't overlap; with streaming set, the
+// stores bypass the caches where the host supports it
+inline void copy_bytes(void *dst, const void *src, std::size_t bytes, bool streaming)
+{
+#if defined(THRUST_HAS_SSE2_STREAMING_STORES)
+  if(streaming)
+  {
+    char       *d = static_cast<char *>(dst);
+    const char *s = static_cast<const char *>(src);
+
+    // the bytes up to the first 16-byte boundary of dst
+    std::size_t head = (16 - reinterpret_cast<std::uintptr_t>(d) % 16) % 16;
+    head = head < bytes ? head : bytes;
+
+    std::memcpy(d, s, head);
+
+    std::size_t i = head;
+
+    for(; i + 16 <= bytes; i += 16)
+    {
+      _mm_stream_si128(reinterpret_cast<__m128i *>(d + i), _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i)));
+    }
+
+    // the streaming stores must be visible before anyone reads dst
+    _mm_sfence();
+
+    std::memcpy(d + i, s + i, bytes - i);
+
+    return;
+  }
+#else
+  (void) streaming;
+#endif
+
+  if(bytes > 0)
+  {
+    std::memcpy(dst, src, bytes);
+  }
+}
+
+
+// assigns value to the n elements at first, where T is trivially copyable;
+// with streaming set, the stores bypass the caches where the host supports it
+// and T's size divides a 16-byte store
+template<typename T>
+void fill_elements(T *first, std::size_t n, const T &value, bool streaming)
+{
+  T *last = first + n;
+
+#if defined(THRUST_HAS_SSE2_STREAMING_STORES)
+  if(streaming && 16 % sizeof(T) == 0 && reinterpret_cast<std::uintptr_t>(first) % sizeof(T) == 0)
+  {
+    // the elements up to the first 16-byte boundary
+    for(; first != last && reinterpret_cast<std::uintptr_t>(first) % 16 != 0; ++first)
+    {
+      *first = value;
+    }
+
+    // a 16-byte store of consecutive copies of value
+    unsigned char pattern[16];
+
+    for(std::size_t i = 0; i < 16; i += sizeof(T))
+    {
+      std::memcpy(pattern + i, &value, sizeof(T));
+    }
+
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pattern));
+
+    const std::ptrdiff_t block_size = 16 / sizeof(T);
+
+    for(; last - first >= block_size; first += block_size)
+    {
+      _mm_stream_si128(reinterpret_cast<__m128i *>(first), block);
+    }
+
+    // the streaming stores must be visible before anyone reads the elements
+    _mm_sfence();
+  }
+#else
+  (void) streaming;
+#endif
+
+  std::fill(first, last, value);
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -34,6 +34,7 @@
 #include <thrust/advance.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/iterator_categories.h>
 #include <thrust/detail/function.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -45,24 +46,62 @@ namespace sequential
 {
 
 
+namespace binary_search_detail
+{
+
+
+// true for the elements before the lower bound of val
+template<typename StrictWeakOrdering, typename T>
+struct lower_bound_predicate
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering,bool> comp;
+  const T &val;
+
+  _CCCL_HOST_DEVICE
+  lower_bound_predicate(StrictWeakOrdering comp, const T &val)
+    : comp(comp), val(val)
+  {}
+
+  template<typename U>
+  _CCCL_HOST_DEVICE
+  bool operator()(const U &x)
+  {
+    return comp(x, val);
+  }
+};
+
+
+// true for the elements before the upper bound of val
+template<typename StrictWeakOrdering, typename T>
+struct upper_bound_predicate
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering,bool> comp;
+  const T &val;
+
+  _CCCL_HOST_DEVICE
+  upper_bound_predicate(StrictWeakOrdering comp, const T &val)
+    : comp(comp), val(val)
+  {}
+
+  template<typename U>
+  _CCCL_HOST_DEVICE
+  bool operator()(const U &x)
+  {
+    return !comp(val, x);
+  }
+};
+
+
+// the first element of [first, last) for which pred is false, where pred
+// is true for a prefix of the range
 _CCCL_EXEC_CHECK_DISABLE
-template<typename DerivedPolicy,
-         typename ForwardIterator,
-         typename T,
-         typename StrictWeakOrdering>
+template<typename ForwardIterator, typename Predicate>
 _CCCL_HOST_DEVICE
-ForwardIterator lower_bound(sequential::execution_policy<DerivedPolicy> &,
-                            ForwardIterator first,
-                            ForwardIterator last,
-                            const T& val,
-                            StrictWeakOrdering comp)
+ForwardIterator partition_point(ForwardIterator first,
+                                ForwardIterator last,
+                                Predicate pred,
+                                thrust::incrementable_traversal_tag)
 {
-  // wrap comp
-  thrust::detail::wrapped_function<
-    StrictWeakOrdering,
-    bool
-  > wrapped_comp(comp);
-
   typedef typename thrust::iterator_difference<ForwardIterator>::type difference_type;
 
   difference_type len = thrust::distance(first, last);
@@ -74,7 +113,7 @@ ForwardIterator lower_bound(sequential::execution_policy<DerivedPolicy> &,
 
     thrust::advance(middle, half);
 
-    if(wrapped_comp(*middle, val))
+    if(pred(*middle))
     {
       first = middle;
       ++first;
@@ -90,48 +129,79 @@ ForwardIterator lower_bound(sequential::execution_policy<DerivedPolicy> &,
 }
 
 
+// With random access, every step narrows the range to the same length
+// whatever pred says at its middle, and only moves its beginning up to the
+// middle when pred holds there. That choice compiles to a conditional move
+// rather than a branch, which would be mispredicted for half of all steps.
+_CCCL_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator, typename Predicate>
+_CCCL_HOST_DEVICE
+RandomAccessIterator partition_point(RandomAccessIterator first,
+                                     RandomAccessIterator last,
+                                     Predicate pred,
+                                     thrust::random_access_traversal_tag)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  difference_type len = last - first;
+
+  if(len == 0)
+  {
+    return first;
+  }
+
+  while(len > 1)
+  {
+    const difference_type half = len >> 1;
+
+    first += pred(first[half]) ? half : difference_type(0);
+    len   -= half;
+  }
+
+  return first + (pred(*first) ? difference_type(1) : difference_type(0));
+}
+
+
+} // end namespace binary_search_detail
+
+
 _CCCL_EXEC_CHECK_DISABLE
 template<typename DerivedPolicy,
          typename ForwardIterator,
          typename T,
          typename StrictWeakOrdering>
 _CCCL_HOST_DEVICE
-ForwardIterator upper_bound(sequential::execution_policy<DerivedPolicy> &,
+ForwardIterator lower_bound(sequential::execution_policy<DerivedPolicy> &,
                             ForwardIterator first,
                             ForwardIterator last,
                             const T& val,
                             StrictWeakOrdering comp)
 {
-  // wrap comp
-  thrust::detail::wrapped_function<
-    StrictWeakOrdering,
-    bool
-  > wrapped_comp(comp);
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
 
-  typedef typename thrust::iterator_difference<ForwardIterator>::type difference_type;
-
-  difference_type len = thrust::distance(first, last);
-
-  while(len > 0)
-  {
-    difference_type half = len >> 1;
-    ForwardIterator middle = first;
+  return binary_search_detail::partition_point(first, last,
+                                               binary_search_detail::lower_bound_predicate<StrictWeakOrdering,T>(comp, val),
+                                               traversal());
+}
 
-    thrust::advance(middle, half);
 
-    if(wrapped_comp(val, *middle))
-    {
-      len = half;
-    }
-    else
-    {
-      first = middle;
-      ++first;
-      len = len - half - 1;
-    }
-  }
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename T,
+         typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE
+ForwardIterator upper_bound(sequential::execution_policy<DerivedPolicy> &,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            const T& val,
+                            StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
 
-  return first;
+  return binary_search_detail::partition_point(first, last,
+                                               binary_search_detail::upper_bound_predicate<StrictWeakOrdering,T>(comp, val),
+                                               traversal());
 }
 
 
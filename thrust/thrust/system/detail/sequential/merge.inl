@@ -26,10 +26,13 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/detail/sequential/merge.h>
+#include <thrust/system/detail/sequential/merge_strategy.h>
 #include <thrust/detail/copy.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/function.h>
 
+#include <nv/target>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -37,6 +40,8 @@ namespace detail
 {
 namespace sequential
 {
+namespace merge_detail
+{
 
 
 _CCCL_EXEC_CHECK_DISABLE
@@ -52,7 +57,9 @@ OutputIterator merge(sequential::execution_policy<DerivedPolicy> &exec,
                      InputIterator2 first2,
                      InputIterator2 last2,
                      OutputIterator result,
-                     StrictWeakOrdering comp)
+                     StrictWeakOrdering comp,
+                     thrust::detail::false_type, // can't gallop
+                     thrust::detail::false_type) // can't merge without branches
 {
   // wrap comp
   thrust::detail::wrapped_function<
@@ -80,6 +87,132 @@ OutputIterator merge(sequential::execution_policy<DerivedPolicy> &exec,
 } // end merge()
 
 
+// each step stores the lesser head and advances past it by the outcome of
+// the comparison, so that nothing depends on a prediction
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE
+OutputIterator merge(sequential::execution_policy<DerivedPolicy> &exec,
+                     RandomAccessIterator1 first1,
+                     RandomAccessIterator1 last1,
+                     RandomAccessIterator2 first2,
+                     RandomAccessIterator2 last2,
+                     OutputIterator result,
+                     StrictWeakOrdering comp,
+                     thrust::detail::false_type, // don't gallop
+                     thrust::detail::true_type)  // merge without branches
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type T;
+
+  while(first1 != last1 && first2 != last2)
+  {
+    const T a = *first1;
+    const T b = *first2;
+
+    // equivalent heads take from the first range, for stability
+    const bool take2 = comp(b, a);
+
+    *result = take2 ? b : a;
+
+    first1 += !take2;
+    first2 += take2;
+    ++result;
+  } // end while
+
+  return thrust::copy(exec, first2, last2, thrust::copy(exec, first1, last1, result));
+} // end merge()
+
+
+// copies the run of each range which precedes the head of the other at once,
+// finding its end by galloping
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering,
+         typename MergeWithoutBranches>
+_CCCL_HOST_DEVICE
+OutputIterator merge(sequential::execution_policy<DerivedPolicy> &exec,
+                     RandomAccessIterator1 first1,
+                     RandomAccessIterator1 last1,
+                     RandomAccessIterator2 first2,
+                     RandomAccessIterator2 last2,
+                     OutputIterator result,
+                     StrictWeakOrdering comp,
+                     thrust::detail::true_type, // may gallop
+                     MergeWithoutBranches merge_without_branches)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      T1;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      T2;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type difference_type1;
+  typedef typename thrust::iterator_difference<RandomAccessIterator2>::type difference_type2;
+
+  if(!is_skewed(last1 - first1, last2 - first2))
+  {
+    return merge_detail::merge(exec, first1, last1, first2, last2, result, comp, thrust::detail::false_type(), merge_without_branches);
+  }
+
+  while(first1 != last1 && first2 != last2)
+  {
+    // the elements of the first range which don't follow *first2
+    const T2 b = *first2;
+    const difference_type1 run1 = gallop(first1, last1, binary_search_detail::upper_bound_predicate<StrictWeakOrdering,T2>(comp, b));
+
+    result = thrust::copy(exec, first1, first1 + run1, result);
+    first1 += run1;
+
+    if(first1 == last1)
+    {
+      break;
+    }
+
+    // the elements of the second range which precede *first1
+    const T1 a = *first1;
+    const difference_type2 run2 = gallop(first2, last2, binary_search_detail::lower_bound_predicate<StrictWeakOrdering,T1>(comp, a));
+
+    result = thrust::copy(exec, first2, first2 + run2, result);
+    first2 += run2;
+  } // end while
+
+  return thrust::copy(exec, first2, last2, thrust::copy(exec, first1, last1, result));
+} // end merge()
+
+
+} // end namespace merge_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE
+OutputIterator merge(sequential::execution_policy<DerivedPolicy> &exec,
+                     InputIterator1 first1,
+                     InputIterator1 last1,
+                     InputIterator2 first2,
+                     InputIterator2 last2,
+                     OutputIterator result,
+                     StrictWeakOrdering comp)
+{
+  // CUDA threads keep the plain two pointer loop
+  NV_IF_TARGET(NV_IS_HOST, (
+    can_gallop<InputIterator1,InputIterator2> may_gallop;
+    can_merge_without_branches<InputIterator1,InputIterator2,StrictWeakOrdering> merge_without_branches;
+    return merge_detail::merge(exec, first1, last1, first2, last2, result, comp, may_gallop, merge_without_branches);
+  ), ( // NV_IS_DEVICE:
+    thrust::detail::false_type may_gallop;
+    thrust::detail::false_type merge_without_branches;
+    return merge_detail::merge(exec, first1, last1, first2, last2, result, comp, may_gallop, merge_without_branches);
+  ));
+} // end merge()
+
+
 _CCCL_EXEC_CHECK_DISABLE
 template<typename DerivedPolicy,
          typename InputIterator1,
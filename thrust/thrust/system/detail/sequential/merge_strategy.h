@@ -0,0 +1,144 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file merge_strategy.h
+ *  \brief How the sequential merge and set operations step through their
+ *         inputs.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/functional.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/iterator_categories.h>
+#include <thrust/system/detail/sequential/binary_search.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace merge_strategy_detail
+{
+
+
+template<typename Iterator>
+struct is_random_access
+  : thrust::detail::is_convertible<
+      typename thrust::iterator_traversal<Iterator>::type,
+      thrust::random_access_traversal_tag
+    >
+{};
+
+
+} // end namespace merge_strategy_detail
+
+
+// Inputs which can be searched may be merged by galloping over the runs of
+// the longer which fall between consecutive elements of the shorter.
+template<typename Iterator1, typename Iterator2>
+struct can_gallop
+  : thrust::detail::and_<
+      merge_strategy_detail::is_random_access<Iterator1>,
+      merge_strategy_detail::is_random_access<Iterator2>
+    >
+{};
+
+
+// Arithmetic keys ordered by less or greater are cheap to copy and compare,
+// so each step of a merge can load both heads and advance by the outcome of
+// the comparison rather than branch on it: random keys make that branch
+// mispredict every other step.
+template<typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
+struct can_merge_without_branches
+  : thrust::detail::and_<
+      can_gallop<Iterator1,Iterator2>,
+      thrust::detail::is_same<
+        typename thrust::iterator_value<Iterator1>::type,
+        typename thrust::iterator_value<Iterator2>::type
+      >,
+      thrust::detail::is_arithmetic<typename thrust::iterator_value<Iterator1>::type>,
+      thrust::detail::or_<
+        thrust::detail::is_same<StrictWeakOrdering, thrust::less<typename thrust::iterator_value<Iterator1>::type> >,
+        thrust::detail::is_same<StrictWeakOrdering, thrust::greater<typename thrust::iterator_value<Iterator1>::type> >
+      >
+    >
+{};
+
+
+// galloping pays for its searches once the longer input has this many
+// elements for each of the shorter's
+const long gallop_ratio = 8;
+
+
+template<typename Size1, typename Size2>
+_CCCL_HOST_DEVICE
+bool is_skewed(Size1 n1, Size2 n2)
+{
+  return n1 / gallop_ratio > n2 || n2 / gallop_ratio > n1;
+}
+
+
+// The number of elements at the front of [first, last) for which pred is
+// true, where pred is true for a prefix of the range: probes first[0],
+// first[1], first[3], ... until pred fails and then bisects the last gap, so
+// that the cost grows with the length of the prefix rather than with the
+// length of the range.
+_CCCL_EXEC_CHECK_DISABLE
+template<typename RandomAccessIterator, typename Predicate>
+_CCCL_HOST_DEVICE
+typename thrust::iterator_difference<RandomAccessIterator>::type
+  gallop(RandomAccessIterator first,
+         RandomAccessIterator last,
+         Predicate pred)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  const difference_type n = last - first;
+
+  // pred is true for [first, first + lo)
+  difference_type lo = 0;
+  difference_type hi = 1;
+
+  while(hi <= n && pred(first[hi - 1]))
+  {
+    lo = hi;
+    hi = 2 * hi;
+  }
+
+  hi = (hi - 1 < n) ? hi - 1 : n;
+
+  return binary_search_detail::partition_point(first + lo, first + hi, pred, thrust::random_access_traversal_tag()) - first;
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -31,8 +31,12 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/merge_strategy.h>
 #include <thrust/detail/copy.h>
 #include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <nv/target>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -41,22 +45,101 @@ namespace detail
 {
 namespace sequential
 {
+namespace set_operations_detail
+{
+
+
+// Each set operation steps through its inputs alike: past the head of the
+// first range when it precedes the head of the second, past the head of the
+// second when it precedes the head of the first, and past both when they're
+// equivalent. They differ only in which of those steps also emit the head:
+// the first's, the second's, or, for equivalent heads, the first's.
+struct difference_operation
+{
+  _CCCL_HOST_DEVICE
+  static bool emits(bool first_precedes, bool)
+  {
+    return first_precedes;
+  }
+};
+
+
+struct intersection_operation
+{
+  _CCCL_HOST_DEVICE
+  static bool emits(bool first_precedes, bool second_precedes)
+  {
+    return !first_precedes && !second_precedes;
+  }
+};
 
 
+struct symmetric_difference_operation
+{
+  _CCCL_HOST_DEVICE
+  static bool emits(bool first_precedes, bool second_precedes)
+  {
+    return first_precedes || second_precedes;
+  }
+};
+
+
+struct union_operation
+{
+  _CCCL_HOST_DEVICE
+  static bool emits(bool, bool)
+  {
+    return true;
+  }
+};
+
+
+// copies what's left of the ranges once either is exhausted
 _CCCL_EXEC_CHECK_DISABLE
-template<typename DerivedPolicy,
+template<typename Operation,
+         typename DerivedPolicy,
          typename InputIterator1,
          typename InputIterator2,
-         typename OutputIterator,
-         typename StrictWeakOrdering>
+         typename OutputIterator>
 _CCCL_HOST_DEVICE
-  OutputIterator set_difference(sequential::execution_policy<DerivedPolicy> &exec,
+  OutputIterator copy_remainder(sequential::execution_policy<DerivedPolicy> &exec,
                                 InputIterator1 first1,
                                 InputIterator1 last1,
                                 InputIterator2 first2,
                                 InputIterator2 last2,
-                                OutputIterator result,
-                                StrictWeakOrdering comp)
+                                OutputIterator result)
+{
+  if(Operation::emits(true, false))
+  {
+    result = thrust::copy(exec, first1, last1, result);
+  }
+
+  if(Operation::emits(false, true))
+  {
+    result = thrust::copy(exec, first2, last2, result);
+  }
+
+  return result;
+} // end copy_remainder()
+
+
+_CCCL_EXEC_CHECK_DISABLE
+template<typename Operation,
+         typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE
+  OutputIterator set_operation(sequential::execution_policy<DerivedPolicy> &exec,
+                               InputIterator1 first1,
+                               InputIterator1 last1,
+                               InputIterator2 first2,
+                               InputIterator2 last2,
+                               OutputIterator result,
+                               StrictWeakOrdering comp,
+                               thrust::detail::false_type, // can't gallop
+                               thrust::detail::false_type) // can't merge without branches
 {
   // wrap comp
   thrust::detail::wrapped_function<
@@ -68,40 +151,129 @@ _CCCL_HOST_DEVICE
   {
     if(wrapped_comp(*first1,*first2))
     {
-      *result = *first1;
+      if(Operation::emits(true, false))
+      {
+        *result = *first1;
+        ++result;
+      }
+
       ++first1;
-      ++result;
     } // end if
     else if(wrapped_comp(*first2,*first1))
     {
+      if(Operation::emits(false, true))
+      {
+        *result = *first2;
+        ++result;
+      }
+
       ++first2;
     } // end else if
     else
     {
+      if(Operation::emits(false, false))
+      {
+        *result = *first1;
+        ++result;
+      }
+
       ++first1;
       ++first2;
     } // end else
   } // end while
 
-  return thrust::copy(exec, first1, last1, result);
-} // end set_difference()
+  return set_operations_detail::copy_remainder<Operation>(exec, first1, last1, first2, last2, result);
+} // end set_operation()
 
 
+// Each step stores the head it would emit and advances the ranges and the
+// count of elements stored by the outcomes of the comparisons, so that
+// nothing depends on a prediction. As a step may emit nothing, the elements
+// are stored to a buffer whose end is always safe to write, and copied out
+// when it fills.
 _CCCL_EXEC_CHECK_DISABLE
-template<typename DerivedPolicy,
-         typename InputIterator1,
-         typename InputIterator2,
+template<typename Operation,
+         typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
          typename OutputIterator,
          typename StrictWeakOrdering>
 _CCCL_HOST_DEVICE
-  OutputIterator set_intersection(sequential::execution_policy<DerivedPolicy> &,
-                                  InputIterator1 first1,
-                                  InputIterator1 last1,
-                                  InputIterator2 first2,
-                                  InputIterator2 last2,
-                                  OutputIterator result,
-                                  StrictWeakOrdering comp)
+  OutputIterator set_operation(sequential::execution_policy<DerivedPolicy> &exec,
+                               RandomAccessIterator1 first1,
+                               RandomAccessIterator1 last1,
+                               RandomAccessIterator2 first2,
+                               RandomAccessIterator2 last2,
+                               OutputIterator result,
+                               StrictWeakOrdering comp,
+                               thrust::detail::false_type, // don't gallop
+                               thrust::detail::true_type)  // merge without branches
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type T;
+
+  const int buffer_size = 64;
+
+  T buffer[buffer_size];
+  int count = 0;
+
+  while(first1 != last1 && first2 != last2)
+  {
+    const T a = *first1;
+    const T b = *first2;
+
+    const bool first_precedes  = comp(a, b);
+    const bool second_precedes = comp(b, a);
+
+    buffer[count] = second_precedes ? b : a;
+    count += Operation::emits(first_precedes, second_precedes);
+
+    first1 += !second_precedes;
+    first2 += !first_precedes;
+
+    if(count == buffer_size)
+    {
+      result = thrust::copy(exec, buffer, buffer + count, result);
+      count = 0;
+    }
+  } // end while
+
+  result = thrust::copy(exec, buffer, buffer + count, result);
+
+  return set_operations_detail::copy_remainder<Operation>(exec, first1, last1, first2, last2, result);
+} // end set_operation()
+
+
+// skips or copies the run of each range which precedes the head of the other
+// at once, finding its end by galloping
+_CCCL_EXEC_CHECK_DISABLE
+template<typename Operation,
+         typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering,
+         typename MergeWithoutBranches>
+_CCCL_HOST_DEVICE
+  OutputIterator set_operation(sequential::execution_policy<DerivedPolicy> &exec,
+                               RandomAccessIterator1 first1,
+                               RandomAccessIterator1 last1,
+                               RandomAccessIterator2 first2,
+                               RandomAccessIterator2 last2,
+                               OutputIterator result,
+                               StrictWeakOrdering comp,
+                               thrust::detail::true_type, // may gallop
+                               MergeWithoutBranches merge_without_branches)
 {
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      T1;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      T2;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type difference_type1;
+  typedef typename thrust::iterator_difference<RandomAccessIterator2>::type difference_type2;
+
+  if(!is_skewed(last1 - first1, last2 - first2))
+  {
+    return set_operations_detail::set_operation<Operation>(exec, first1, last1, first2, last2, result, comp, thrust::detail::false_type(), merge_without_branches);
+  }
+
   // wrap comp
   thrust::detail::wrapped_function<
     StrictWeakOrdering,
@@ -110,28 +282,120 @@ _CCCL_HOST_DEVICE
 
   while(first1 != last1 && first2 != last2)
   {
-    if(wrapped_comp(*first1,*first2))
+    // the elements of the first range which precede *first2
+    const T2 b = *first2;
+    const difference_type1 run1 = gallop(first1, last1, binary_search_detail::lower_bound_predicate<StrictWeakOrdering,T2>(comp, b));
+
+    if(Operation::emits(true, false))
     {
-      ++first1;
-    } // end if
-    else if(wrapped_comp(*first2,*first1))
+      result = thrust::copy(exec, first1, first1 + run1, result);
+    }
+
+    first1 += run1;
+
+    if(first1 == last1)
     {
-      ++first2;
-    } // end else if
-    else
+      break;
+    }
+
+    // the elements of the second range which precede *first1
+    const T1 a = *first1;
+    const difference_type2 run2 = gallop(first2, last2, binary_search_detail::lower_bound_predicate<StrictWeakOrdering,T1>(comp, a));
+
+    if(Operation::emits(false, true))
     {
-      *result = *first1;
+      result = thrust::copy(exec, first2, first2 + run2, result);
+    }
+
+    first2 += run2;
+
+    // unless *first1 precedes the new head of the second range, the heads
+    // are equivalent
+    if(first2 != last2 && !wrapped_comp(*first1, *first2))
+    {
+      if(Operation::emits(false, false))
+      {
+        *result = *first1;
+        ++result;
+      }
+
       ++first1;
       ++first2;
-      ++result;
-    } // end else
+    } // end if
   } // end while
 
-  return result;
-} // end set_intersection()
+  return set_operations_detail::copy_remainder<Operation>(exec, first1, last1, first2, last2, result);
+} // end set_operation()
 
 
 _CCCL_EXEC_CHECK_DISABLE
+template<typename Operation,
+         typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE
+  OutputIterator set_operation(sequential::execution_policy<DerivedPolicy> &exec,
+                               InputIterator1 first1,
+                               InputIterator1 last1,
+                               InputIterator2 first2,
+                               InputIterator2 last2,
+                               OutputIterator result,
+                               StrictWeakOrdering comp)
+{
+  // CUDA threads keep the plain two pointer loop
+  NV_IF_TARGET(NV_IS_HOST, (
+    can_gallop<InputIterator1,InputIterator2> may_gallop;
+    can_merge_without_branches<InputIterator1,InputIterator2,StrictWeakOrdering> merge_without_branches;
+    return set_operations_detail::set_operation<Operation>(exec, first1, last1, first2, last2, result, comp, may_gallop, merge_without_branches);
+  ), ( // NV_IS_DEVICE:
+    thrust::detail::false_type may_gallop;
+    thrust::detail::false_type merge_without_branches;
+    return set_operations_detail::set_operation<Operation>(exec, first1, last1, first2, last2, result, comp, may_gallop, merge_without_branches);
+  ));
+} // end set_operation()
+
+
+} // end namespace set_operations_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE
+  OutputIterator set_difference(sequential::execution_policy<DerivedPolicy> &exec,
+                                InputIterator1 first1,
+                                InputIterator1 last1,
+                                InputIterator2 first2,
+                                InputIterator2 last2,
+                                OutputIterator result,
+                                StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation<set_operations_detail::difference_operation>(exec, first1, last1, first2, last2, result, comp);
+} // end set_difference()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE
+  OutputIterator set_intersection(sequential::execution_policy<DerivedPolicy> &exec,
+                                  InputIterator1 first1,
+                                  InputIterator1 last1,
+                                  InputIterator2 first2,
+                                  InputIterator2 last2,
+                                  OutputIterator result,
+                                  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation<set_operations_detail::intersection_operation>(exec, first1, last1, first2, last2, result, comp);
+} // end set_intersection()
+
+
 template<typename DerivedPolicy,
          typename InputIterator1,
          typename InputIterator2,
@@ -146,38 +410,10 @@ _CCCL_HOST_DEVICE
                                           OutputIterator result,
                                           StrictWeakOrdering comp)
 {
-  // wrap comp
-  thrust::detail::wrapped_function<
-    StrictWeakOrdering,
-    bool
-  > wrapped_comp(comp);
-
-  while(first1 != last1 && first2 != last2)
-  {
-    if(wrapped_comp(*first1,*first2))
-    {
-      *result = *first1;
-      ++first1;
-      ++result;
-    } // end if
-    else if(wrapped_comp(*first2,*first1))
-    {
-      *result = *first2;
-      ++first2;
-      ++result;
-    } // end else if
-    else
-    {
-      ++first1;
-      ++first2;
-    } // end else
-  } // end while
-
-  return thrust::copy(exec, first2, last2, thrust::copy(exec, first1, last1, result));
+  return set_operations_detail::set_operation<set_operations_detail::symmetric_difference_operation>(exec, first1, last1, first2, last2, result, comp);
 } // end set_symmetric_difference()
 
 
-_CCCL_EXEC_CHECK_DISABLE
 template<typename DerivedPolicy,
          typename InputIterator1,
          typename InputIterator2,
@@ -192,35 +428,7 @@ _CCCL_HOST_DEVICE
                            OutputIterator result,
                            StrictWeakOrdering comp)
 {
-  // wrap comp
-  thrust::detail::wrapped_function<
-    StrictWeakOrdering,
-    bool
-  > wrapped_comp(comp);
-
-  while(first1 != last1 && first2 != last2)
-  {
-    if(wrapped_comp(*first1,*first2))
-    {
-      *result = *first1;
-      ++first1;
-    } // end if
-    else if(wrapped_comp(*first2,*first1))
-    {
-      *result = *first2;
-      ++first2;
-    } // end else if
-    else
-    {
-      *result = *first1;
-      ++first1;
-      ++first2;
-    } // end else
-
-    ++result;
-  } // end while
-
-  return thrust::copy(exec, first2, last2, thrust::copy(exec, first1, last1, result));
+  return set_operations_detail::set_operation<set_operations_detail::union_operation>(exec, first1, last1, first2, last2, result, comp);
 } // end set_union()
 
 
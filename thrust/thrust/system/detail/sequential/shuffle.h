@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2008-2020 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file shuffle.h
+ *  \brief Sequential implementations of shuffle functions.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp11_required.h>
+
+#if _CCCL_STD_VER >= 2011
+
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+
+// The permutation is the same one generic::shuffle_copy computes, so that
+// every system shuffles alike for the same g: the values of the bijection
+// below m, in the order of its arguments. A single sweep picks them out,
+// rather than scanning flags over the whole power of two, and stops once the
+// last of the m has been found.
+_CCCL_EXEC_CHECK_DISABLE
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+_CCCL_HOST_DEVICE
+  void shuffle_copy(sequential::execution_policy<DerivedPolicy> &,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &&g)
+{
+  const std::uint64_t m = last - first;
+
+  thrust::system::detail::generic::feistel_bijection bijection(m, g);
+
+  for(std::uint64_t i = 0, j = 0; j < m; ++i)
+  {
+    const std::uint64_t key = bijection(i);
+
+    if(key < m)
+    {
+      result[j] = first[key];
+      ++j;
+    }
+  }
+} // end shuffle_copy()
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename URBG>
+_CCCL_HOST_DEVICE
+  void shuffle(sequential::execution_policy<DerivedPolicy> &exec,
+               RandomIterator first,
+               RandomIterator last,
+               URBG &&g)
+{
+  typedef typename thrust::iterator_value<RandomIterator>::type InputType;
+
+  // the permutation gathers, so it can't be applied in place
+  thrust::detail::temporary_array<InputType, DerivedPolicy> temp(exec, first, last);
+
+  sequential::shuffle_copy(exec, temp.begin(), temp.end(), first, g);
+} // end shuffle()
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#endif
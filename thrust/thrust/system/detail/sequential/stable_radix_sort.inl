@@ -29,14 +29,14 @@
 #include <thrust/copy.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/iterator/transform_iterator.h>
-#include <thrust/iterator/zip_iterator.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/cstdint.h>
-#include <thrust/scatter.h>
 
 #include <limits>
 
+#include <nv/target>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -148,88 +148,191 @@ struct RadixEncoder<double> : public thrust::unary_function<double, thrust::deta
 };
 
 
-// this functor returns a key's to its histogram bucket count and post-increments the bucket
-template<unsigned int RadixBits, typename KeyType>
-  struct bucket_functor
+// the number of elements of T which fill a cache line
+template<typename T>
+struct elements_per_cache_line
 {
-  typedef RadixEncoder<KeyType> Encoder;
-  typedef typename Encoder::result_type EncodedType;
-  typedef size_t result_type;
-  static const EncodedType BitMask = static_cast<EncodedType>((1 << RadixBits) - 1);
+  static const size_t cache_line_size = 64;
+  static const size_t value = sizeof(T) < cache_line_size ? cache_line_size / sizeof(T) : 1;
+};
 
-  Encoder encode;
-  EncodedType bit_shift;
-  size_t *histogram;
 
-  _CCCL_HOST_DEVICE
-  bucket_functor(EncodedType bit_shift, size_t *histogram)
-    : encode(),
-      bit_shift(bit_shift),
-      histogram(histogram)
-  {}
-
-  inline _CCCL_HOST_DEVICE
-  size_t operator()(KeyType key)
-  {
-    const EncodedType x = encode(key);
+// A pass scatters through cache lines when it has at least this many bits'
+// worth of buckets, fewer of which the TLB covers directly, ...
+const unsigned int write_combining_radix_bits = 8;
 
-    // note that we mutate the histogram here
-    return histogram[(x >> bit_shift) & BitMask]++;
-  }
-};
+// ... and it writes at least this many bytes, short of which its output stays
+// within the reach of the TLB.
+const size_t write_combining_threshold = 1 << 20;
 
 
+// Moves the keys (and values) of one pass straight to the positions of their
+// buckets given by histogram, which is advanced past them.
 template<unsigned int RadixBits,
-         typename DerivedPolicy,
+         bool HasValues,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
-         typename Integer>
-inline _CCCL_HOST_DEVICE
-void radix_shuffle_n(sequential::execution_policy<DerivedPolicy> &exec,
-                     RandomAccessIterator1 first,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+_CCCL_HOST_DEVICE
+void radix_shuffle_n(RandomAccessIterator1 keys_first,
+                     RandomAccessIterator2 values_first,
                      const size_t n,
-                     RandomAccessIterator2 result,
-                     Integer bit_shift,
+                     RandomAccessIterator3 keys_result,
+                     RandomAccessIterator4 values_result,
+                     const unsigned int bit_shift,
                      size_t *histogram)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef RadixEncoder<KeyType> Encoder;
+  typedef typename Encoder::result_type EncodedType;
+
+  const EncodedType BitMask = static_cast<EncodedType>((1 << RadixBits) - 1);
+
+  Encoder encode;
+
+  for(size_t i = 0; i < n; i++)
+  {
+    const KeyType     key = keys_first[i];
+    const EncodedType x   = encode(key);
+
+    const size_t position = histogram[(x >> bit_shift) & BitMask]++;
+
+    keys_result[position] = key;
+
+    if(HasValues)
+    {
+      values_result[position] = values_first[i];
+    }
+  }
+}
+
 
-  // note that we are going to mutate the histogram during this sequential scatter
-  thrust::scatter(exec,
-                  first, first + n,
-                  thrust::make_transform_iterator(first, bucket_functor<RadixBits,KeyType>(bit_shift, histogram)),
-                  result);
+// copies a bucket's staged elements to the output
+template<typename T, typename RandomAccessIterator>
+inline _CCCL_HOST_DEVICE
+void radix_flush_n(const T *buffer, const size_t n, RandomAccessIterator result)
+{
+  for(size_t i = 0; i < n; i++)
+  {
+    result[i] = buffer[i];
+  }
 }
 
 
+// As above, but each bucket stages its elements in a cache line of the
+// buffers and writes them out together once the line fills. Written one at a
+// time, consecutive elements land in as many places as there are buckets, and
+// for large passes those places span more pages than the TLB holds. An
+// element's slot in its bucket's line is its position modulo the line's
+// length, so that the lines go out aligned to the output.
 template<unsigned int RadixBits,
-         typename DerivedPolicy,
+         bool HasValues,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
          typename RandomAccessIterator3,
          typename RandomAccessIterator4,
-         typename Integer>
+         typename KeyType,
+         typename ValueType>
 _CCCL_HOST_DEVICE
-void radix_shuffle_n(sequential::execution_policy<DerivedPolicy> &exec,
-                     RandomAccessIterator1 keys_first,
+void radix_shuffle_n(RandomAccessIterator1 keys_first,
                      RandomAccessIterator2 values_first,
                      const size_t n,
                      RandomAccessIterator3 keys_result,
                      RandomAccessIterator4 values_result,
-                     Integer bit_shift,
-                     size_t *histogram)
+                     const unsigned int bit_shift,
+                     size_t *histogram,
+                     KeyType *key_buffer,
+                     ValueType *value_buffer)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef RadixEncoder<KeyType> Encoder;
+  typedef typename Encoder::result_type EncodedType;
+
+  const unsigned int HistogramSize = 1 << RadixBits;
+  const EncodedType  BitMask       = static_cast<EncodedType>(HistogramSize - 1);
+  const size_t       LineSize      = elements_per_cache_line<KeyType>::value;
+
+  Encoder encode;
+
+  // where each bucket begins, before which its first line holds nothing,
+  // and where its next element goes, kept apart from the caller's histogram
+  // so that stores to the buffers can't be taken to change them
+  size_t begin[HistogramSize];
+  size_t end[HistogramSize];
+
+  for(unsigned int bucket = 0; bucket < HistogramSize; bucket++)
+  {
+    begin[bucket] = end[bucket] = histogram[bucket];
+  }
+
+  for(size_t i = 0; i < n; i++)
+  {
+    const KeyType     key = keys_first[i];
+    const EncodedType x   = encode(key);
+
+    const unsigned int bucket = static_cast<unsigned int>((x >> bit_shift) & BitMask);
+    const size_t       slot   = bucket * LineSize + end[bucket] % LineSize;
+
+    key_buffer[slot] = key;
+
+    if(HasValues)
+    {
+      value_buffer[slot] = values_first[i];
+    }
+
+    if(++end[bucket] % LineSize == 0)
+    {
+      const size_t first = end[bucket] - LineSize;
+      const size_t line  = bucket * LineSize;
 
-  // note that we are going to mutate the histogram during this sequential scatter
-  thrust::scatter(exec,
-                  thrust::make_zip_iterator(thrust::make_tuple(keys_first, values_first)),
-                  thrust::make_zip_iterator(thrust::make_tuple(keys_first + n, values_first + n)),
-                  thrust::make_transform_iterator(keys_first, bucket_functor<RadixBits,KeyType>(bit_shift, histogram)),
-                  thrust::make_zip_iterator(thrust::make_tuple(keys_result, values_result)));
+      if(first >= begin[bucket])
+      {
+        // a whole line, copied by a loop of fixed length
+        radix_flush_n(key_buffer + line, LineSize, keys_result + first);
+
+        if(HasValues)
+        {
+          radix_flush_n(value_buffer + line, LineSize, values_result + first);
+        }
+      }
+      else
+      {
+        // the bucket's first line, which it needn't begin
+        const size_t offset = begin[bucket] - first;
+
+        radix_flush_n(key_buffer + line + offset, LineSize - offset, keys_result + begin[bucket]);
+
+        if(HasValues)
+        {
+          radix_flush_n(value_buffer + line + offset, LineSize - offset, values_result + begin[bucket]);
+        }
+      }
+    }
+  }
+
+  // flush the partial lines
+  for(unsigned int bucket = 0; bucket < HistogramSize; bucket++)
+  {
+    const size_t last  = end[bucket];
+    const size_t lower = last - last % LineSize;
+    const size_t first = lower < begin[bucket] ? begin[bucket] : lower;
+    const size_t line  = bucket * LineSize + (first - lower);
+
+    radix_flush_n(key_buffer + line, last - first, keys_result + first);
+
+    if(HasValues)
+    {
+      radix_flush_n(value_buffer + line, last - first, values_result + first);
+    }
+
+    histogram[bucket] = last;
+  }
 }
 
 
+// LSD radix sort of (keys1,vals1) by digits of RadixBits, which alternate
+// with (keys2,vals2) between passes. The histograms of every digit are
+// counted together in a single read of the keys before the first pass.
 template<unsigned int RadixBits,
          bool HasValues,
          typename DerivedPolicy,
@@ -246,6 +349,7 @@ void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
                 const size_t N)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator3>::type ValueType;
 
   typedef RadixEncoder<KeyType> Encoder;
   typedef typename Encoder::result_type EncodedType;
@@ -255,6 +359,8 @@ void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
 
   const EncodedType BitMask = static_cast<EncodedType>((1 << RadixBits) - 1);
 
+  const size_t LineSize = elements_per_cache_line<KeyType>::value;
+
   Encoder encode;
 
   // storage for histograms
@@ -296,34 +402,40 @@ void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
     }
   }
 
+  // large passes on the host scatter through the buffers
+  bool write_combine = false;
+
+  NV_IF_TARGET(NV_IS_HOST, (
+    write_combine = RadixBits >= write_combining_radix_bits && N * (sizeof(KeyType) + (HasValues ? sizeof(ValueType) : 0)) >= write_combining_threshold;
+  ));
+
+  // a cache line of keys (and values) for each bucket to stage its elements
+  thrust::detail::temporary_array<KeyType, DerivedPolicy>   key_buffer(exec, write_combine ? HistogramSize * LineSize : 0);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> value_buffer(exec, write_combine && HasValues ? HistogramSize * LineSize : 0);
+
+  KeyType   *raw_key_buffer   = thrust::raw_pointer_cast(key_buffer.data());
+  ValueType *raw_value_buffer = thrust::raw_pointer_cast(value_buffer.data());
+
   // shuffle keys and (optionally) values
   for(unsigned int i = 0; i < NumHistograms; i++)
   {
-    const EncodedType BitShift = static_cast<EncodedType>(RadixBits * i);
+    const unsigned int BitShift = RadixBits * i;
 
     if(!skip_shuffle[i])
     {
-      if(flip)
+      if(write_combine)
       {
-        if(HasValues)
-        {
-          radix_shuffle_n<RadixBits>(exec, keys2, vals2, N, keys1, vals1, BitShift, histograms[i]);
-        }
+        if(flip)
+          radix_shuffle_n<RadixBits,HasValues>(keys2, vals2, N, keys1, vals1, BitShift, histograms[i], raw_key_buffer, raw_value_buffer);
         else
-        {
-          radix_shuffle_n<RadixBits>(exec, keys2, N, keys1, BitShift, histograms[i]);
-        }
+          radix_shuffle_n<RadixBits,HasValues>(keys1, vals1, N, keys2, vals2, BitShift, histograms[i], raw_key_buffer, raw_value_buffer);
       }
       else
       {
-        if(HasValues)
-        {
-          radix_shuffle_n<RadixBits>(exec, keys1, vals1, N, keys2, vals2, BitShift, histograms[i]);
-        }
+        if(flip)
+          radix_shuffle_n<RadixBits,HasValues>(keys2, vals2, N, keys1, vals1, BitShift, histograms[i]);
         else
-        {
-          radix_shuffle_n<RadixBits>(exec, keys1, N, keys2, BitShift, histograms[i]);
-        }
+          radix_shuffle_n<RadixBits,HasValues>(keys1, vals1, N, keys2, vals2, BitShift, histograms[i]);
       }
 
       flip = (flip) ? false : true;
@@ -344,7 +456,9 @@ void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
 
 
 // Select best radix sort parameters based on sizeof(T) and input size
-// These particular values were determined through empirical testing on a Core i7 950 CPU
+// These particular values were determined through empirical testing on a Core i7 950 CPU,
+// and revisited once large passes scattered through write-combining buffers: wide digits
+// now pay for large keys, but narrow ones still win for keys with values
 template <size_t KeySize>
 struct radix_sort_dispatcher
 {
@@ -391,20 +505,7 @@ struct radix_sort_dispatcher<2>
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
                   const size_t N)
   {
-#ifdef __QNX__
-    // XXX war for nvbug 200193674
-    const bool condition = true;
-#else
-    const bool condition = N < (1 << 16);
-#endif
-    if (condition)
-    {
-      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
-    }
-    else
-    {
-      radix_sort_detail::radix_sort<16,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
-    }
+    radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
   }
 
 
@@ -419,20 +520,7 @@ struct radix_sort_dispatcher<2>
                   RandomAccessIterator3 vals1, RandomAccessIterator4 vals2,
                   const size_t N)
   {
-#ifdef __QNX__
-    // XXX war for nvbug 200193674
-    const bool condition = true;
-#else
-    const bool condition = N < (1 << 15);
-#endif
-    if (condition)
-    {
-      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N);
-    }
-    else
-    {
-      radix_sort_detail::radix_sort<16,true>(exec, keys1, keys2, vals1, vals2, N);
-    }
+    radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N);
   }
 };
 
@@ -454,7 +542,7 @@ struct radix_sort_dispatcher<4>
     }
     else
     {
-      radix_sort_detail::radix_sort<4,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<11,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
     }
   }
 
@@ -498,7 +586,7 @@ struct radix_sort_dispatcher<8>
     }
     else
     {
-      radix_sort_detail::radix_sort<4,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<11,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
     }
   }
 
@@ -0,0 +1,81 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file launch.h
+ *  \brief Sizes the teams of the asynchronous algorithms of the OpenMP system.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#include <thrust/detail/minmax.h>
+#include <thrust/system/cpp/detail/async/launch.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/num_threads.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system { namespace omp { namespace detail
+{
+
+// Enqueues job on the threads of the Standard C++ system. All of them may run
+// an algorithm at once, so the teams they open share the calling thread's
+// omp_get_max_threads() rather than each taking all of it, which would
+// oversubscribe the host by about the pool's size. A policy which asks for a
+// number of threads through on() still gets them.
+template<typename DerivedPolicy, typename Job>
+void enqueue_async(execution_policy<DerivedPolicy> &, Job job)
+{
+  thrust::system::cpp::detail::async_thread_pool &pool = thrust::system::cpp::detail::async_thread_pool::instance();
+
+  int team_size = 1;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  team_size = thrust::max<int>(1, omp_get_max_threads() / static_cast<int>(pool.size()));
+#endif
+
+  pool.enqueue([team_size, job]() mutable
+  {
+    num_threads_guard guard(team_size);
+
+    job();
+  });
+}
+
+}}} // namespace system::omp::detail
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
+
@@ -26,7 +26,15 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/omp/detail/execution_policy.h>
-#include <thrust/system/detail/generic/binary_search.h>
+#include <thrust/system/omp/detail/num_threads.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/parallel_binary_search.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/binary_search.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -37,40 +45,140 @@ namespace detail
 {
 
 
-template <typename DerivedPolicy, typename ForwardIterator, typename T, typename StrictWeakOrdering>
-ForwardIterator lower_bound(execution_policy<DerivedPolicy> &exec,
-                            ForwardIterator begin,
-                            ForwardIterator end,
-                            const T& value,
-                            StrictWeakOrdering comp)
+// the scalar searches are inherited from cpp: a single search is over long
+// before a parallel region would have started, and needs no temporary storage
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator lower_bound(execution_policy<DerivedPolicy> &exec,
+                           ForwardIterator begin,
+                           ForwardIterator end,
+                           InputIterator values_begin,
+                           InputIterator values_end,
+                           OutputIterator output,
+                           StrictWeakOrdering comp)
 {
-    // omp prefers generic::lower_bound to cpp::lower_bound
-    return thrust::system::detail::generic::lower_bound(exec, begin, end, value, comp);
-}
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<InputIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type m = values_end - values_begin;
 
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = default_decomposition(m);
 
-template <typename DerivedPolicy, typename ForwardIterator, typename T, typename StrictWeakOrdering, typename Backend>
-ForwardIterator upper_bound(execution_policy<DerivedPolicy> &exec,
-                            ForwardIterator begin,
-                            ForwardIterator end,
-                            const T& value,
-                            StrictWeakOrdering comp)
+  if(decomp.size() <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::binary_search_algorithm, value_type>(exec, m))
+  {
+    return thrust::lower_bound(thrust::seq, begin, end, values_begin, values_end, output, comp);
+  }
+
+  return thrust::system::detail::internal::parallel_binary_search<thrust::system::detail::internal::binary_search_detail::lower_bound_search>
+    (for_each_tile(), begin, difference_type(end - begin), values_begin, m, output, decomp.size(), comp);
+} // end lower_bound()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator upper_bound(execution_policy<DerivedPolicy> &exec,
+                           ForwardIterator begin,
+                           ForwardIterator end,
+                           InputIterator values_begin,
+                           InputIterator values_end,
+                           OutputIterator output,
+                           StrictWeakOrdering comp)
 {
-    // omp prefers generic::upper_bound to cpp::upper_bound
-    return thrust::system::detail::generic::upper_bound(exec, begin, end, value, comp);
-}
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<InputIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
 
+  const difference_type m = values_end - values_begin;
 
-template <typename DerivedPolicy, typename ForwardIterator, typename T, typename StrictWeakOrdering>
-bool binary_search(execution_policy<DerivedPolicy> &exec,
-                   ForwardIterator begin,
-                   ForwardIterator end,
-                   const T& value,
-                   StrictWeakOrdering comp)
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = default_decomposition(m);
+
+  if(decomp.size() <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::binary_search_algorithm, value_type>(exec, m))
+  {
+    return thrust::upper_bound(thrust::seq, begin, end, values_begin, values_end, output, comp);
+  }
+
+  return thrust::system::detail::internal::parallel_binary_search<thrust::system::detail::internal::binary_search_detail::upper_bound_search>
+    (for_each_tile(), begin, difference_type(end - begin), values_begin, m, output, decomp.size(), comp);
+} // end upper_bound()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator binary_search(execution_policy<DerivedPolicy> &exec,
+                             ForwardIterator begin,
+                             ForwardIterator end,
+                             InputIterator values_begin,
+                             InputIterator values_end,
+                             OutputIterator output,
+                             StrictWeakOrdering comp)
 {
-    // omp prefers generic::binary_search to cpp::binary_search
-    return thrust::system::detail::generic::binary_search(exec, begin, end, value, comp);
-}
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<InputIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type m = values_end - values_begin;
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = default_decomposition(m);
+
+  if(decomp.size() <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::binary_search_algorithm, value_type>(exec, m))
+  {
+    return thrust::binary_search(thrust::seq, begin, end, values_begin, values_end, output, comp);
+  }
+
+  return thrust::system::detail::internal::parallel_binary_search<thrust::system::detail::internal::binary_search_detail::binary_search_search>
+    (for_each_tile(), begin, difference_type(end - begin), values_begin, m, output, decomp.size(), comp);
+} // end binary_search()
 
 
 } // end detail
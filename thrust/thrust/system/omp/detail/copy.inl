@@ -26,9 +26,21 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/omp/detail/copy.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/omp/detail/num_threads.h>
 #include <thrust/system/detail/generic/copy.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/streaming_store.h>
 #include <thrust/system/detail/sequential/copy.h>
+#include <thrust/system/detail/sequential/trivial_copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+
+#include <cstddef>
+#include <functional>
 
 
 THRUST_NAMESPACE_BEGIN
@@ -38,6 +50,138 @@ namespace omp
 {
 namespace detail
 {
+namespace copy_detail
+{
+
+
+// copies one block of bytes; blocks begin on cache lines of the destination
+struct copy_block
+{
+  char                                                                   *dst;
+  const char                                                             *src;
+  std::size_t                                                             bytes;
+  thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> blocks;
+  bool                                                                    streaming;
+
+  copy_block(char *dst,
+             const char *src,
+             std::size_t bytes,
+             thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> blocks,
+             bool streaming)
+    : dst(dst), src(src), bytes(bytes), blocks(blocks), streaming(streaming)
+  {}
+
+  void operator()(std::ptrdiff_t block) const
+  {
+    const std::size_t begin = thrust::system::detail::internal::cache_line_edge(dst, blocks[block].begin(), bytes);
+    const std::size_t end   = thrust::system::detail::internal::cache_line_edge(dst, blocks[block].end(),   bytes);
+
+    if(begin < end)
+    {
+      thrust::system::detail::internal::copy_bytes(dst + begin, src + begin, end - begin, streaming);
+    }
+  }
+};
+
+
+// Copies n trivially relocatable elements with memcpy, one block per thread,
+// as a single thread can't saturate the memory bandwidth of a host. Copies
+// larger than the last level cache store around it.
+template<typename DerivedPolicy, typename T>
+T *trivial_copy_n(execution_policy<DerivedPolicy> &exec,
+                  const T *first,
+                  std::ptrdiff_t n,
+                  T *result)
+{
+  num_threads_guard guard(exec);
+
+  const std::size_t bytes = n * sizeof(T);
+
+  const char *src = reinterpret_cast<const char *>(first);
+  char       *dst = reinterpret_cast<char *>(result);
+
+  // overlapping ranges are left to memmove, which copies them in the right order
+  const bool overlap = std::less<const char *>()(src, dst + bytes) && std::less<const char *>()(dst, src + bytes);
+
+  if(overlap || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::copy_algorithm, T>(exec, n))
+  {
+    return thrust::system::detail::sequential::trivial_copy_n(first, n, result);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> blocks =
+    omp::detail::default_decomposition(static_cast<std::ptrdiff_t>(bytes));
+
+  for_each_tile()(blocks.size(),
+                  copy_block(dst, src, bytes, blocks, bytes > thrust::system::detail::internal::streaming_store_threshold));
+
+  return result + n;
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &exec,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::true_type) // is_indirectly_trivially_relocatable_to
+{
+  if(n <= 0) return result;
+
+  omp::detail::copy_detail::trivial_copy_n(exec,
+                                           thrust::detail::contiguous_iterator_raw_pointer_cast(first),
+                                           static_cast<std::ptrdiff_t>(n),
+                                           thrust::detail::contiguous_iterator_raw_pointer_cast(result));
+
+  return result + n;
+} // end copy_n()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &exec,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::false_type) // is_indirectly_trivially_relocatable_to
+{
+  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+} // end copy_n()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator>
+  OutputIterator copy(execution_policy<DerivedPolicy> &exec,
+                      InputIterator first,
+                      InputIterator last,
+                      OutputIterator result,
+                      thrust::detail::true_type) // is_indirectly_trivially_relocatable_to
+{
+  return omp::detail::copy_detail::copy_n(exec, first, last - first, result, thrust::detail::true_type());
+} // end copy()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator>
+  OutputIterator copy(execution_policy<DerivedPolicy> &exec,
+                      InputIterator first,
+                      InputIterator last,
+                      OutputIterator result,
+                      thrust::detail::false_type) // is_indirectly_trivially_relocatable_to
+{
+  return thrust::system::detail::generic::copy(exec, first, last, result);
+} // end copy()
+
+
+} // end copy_detail
+
+
 namespace dispatch
 {
 
@@ -64,7 +208,8 @@ template<typename DerivedPolicy,
                       OutputIterator result,
                       thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  return thrust::system::omp::detail::copy_detail::copy(exec, first, last, result,
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator,OutputIterator>::type());
 } // end copy()
 
 
@@ -92,7 +237,8 @@ template<typename DerivedPolicy,
                         OutputIterator result,
                         thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  return thrust::system::omp::detail::copy_detail::copy_n(exec, first, n, result,
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator,OutputIterator>::type());
 } // end copy_n()
 
 
@@ -26,7 +26,8 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/omp/detail/copy_if.h>
-#include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/system/omp/detail/stream_compaction.h>
+#include <thrust/iterator/discard_iterator.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -49,8 +50,8 @@ template<typename DerivedPolicy,
                          OutputIterator result,
                          Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  // compact the true elements to result and discard the rest
+  return thrust::system::omp::detail::stream_compaction(exec, first, last, stencil, result, thrust::make_discard_iterator(), pred).first;
 } // end copy_if()
 
 
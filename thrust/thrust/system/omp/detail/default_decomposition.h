@@ -31,6 +31,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/schedule.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -43,6 +44,12 @@ namespace detail
 template <typename IndexType>
 thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(IndexType n);
 
+// a decomposition whose intervals are handed out with the schedule sched; a
+// schedule other than the static one gets several intervals per thread so
+// that it has something to balance
+template <typename IndexType>
+thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(IndexType n, loop_schedule sched);
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
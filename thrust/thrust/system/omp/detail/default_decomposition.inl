@@ -56,7 +56,22 @@ thrust::system::detail::internal::uniform_decomposition<IndexType> default_decom
   );
 
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, omp_get_num_procs());
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, omp_get_max_threads());
+#else
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, 1);
+#endif
+}
+
+template <typename IndexType>
+thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(IndexType n, loop_schedule sched)
+{
+  if (sched.kind == schedule_static)
+  {
+    return thrust::system::omp::detail::default_decomposition(n);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, 8 * omp_get_max_threads());
 #else
   return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, 1);
 #endif
@@ -25,7 +25,39 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/omp/detail/execution_policy.h>
 
-// this system inherits fill
-#include <thrust/system/cpp/detail/fill.h>
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
 
+
+template<typename DerivedPolicy,
+         typename OutputIterator,
+         typename Size,
+         typename T>
+OutputIterator fill_n(execution_policy<DerivedPolicy> &exec,
+                      OutputIterator first,
+                      Size n,
+                      const T &value);
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename T>
+void fill(execution_policy<DerivedPolicy> &exec,
+          ForwardIterator first,
+          ForwardIterator last,
+          const T &value);
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/omp/detail/fill.inl>
@@ -0,0 +1,227 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/omp/detail/fill.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/omp/detail/num_threads.h>
+#include <thrust/system/detail/generic/fill.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/streaming_store.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/has_trivial_assign.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace fill_detail
+{
+
+
+// fills one block of elements; blocks begin at the first element which
+// begins on a cache line, so that threads rarely store to the same line
+template<typename T>
+struct fill_block
+{
+  T                                                                      *first;
+  std::ptrdiff_t                                                          n;
+  T                                                                       value;
+  thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> blocks;
+  bool                                                                    streaming;
+
+  fill_block(T *first,
+             std::ptrdiff_t n,
+             const T &value,
+             thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> blocks,
+             bool streaming)
+    : first(first), n(n), value(value), blocks(blocks), streaming(streaming)
+  {}
+
+  std::ptrdiff_t edge(std::ptrdiff_t i) const
+  {
+    const std::size_t bytes = n * sizeof(T);
+    const std::size_t byte_edge = thrust::system::detail::internal::cache_line_edge(first, i * sizeof(T), bytes);
+
+    return static_cast<std::ptrdiff_t>((byte_edge + sizeof(T) - 1) / sizeof(T));
+  }
+
+  void operator()(std::ptrdiff_t block) const
+  {
+    const std::ptrdiff_t begin = edge(blocks[block].begin());
+    const std::ptrdiff_t end   = edge(blocks[block].end());
+
+    if(begin < end)
+    {
+      thrust::system::detail::internal::fill_elements(first + begin, end - begin, value, streaming);
+    }
+  }
+};
+
+
+// Fills n trivially copyable elements, one block per thread, as a single
+// thread can't saturate the memory bandwidth of a host. Fills larger than the
+// last level cache store around it.
+template<typename DerivedPolicy, typename T>
+void trivial_fill_n(execution_policy<DerivedPolicy> &exec,
+                    T *first,
+                    std::ptrdiff_t n,
+                    const T &value)
+{
+  num_threads_guard guard(exec);
+
+  if(thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::fill_algorithm, T>(exec, n))
+  {
+    thrust::system::detail::internal::fill_elements(first, n, value, false);
+    return;
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t> blocks = omp::detail::default_decomposition(n);
+
+  for_each_tile()(blocks.size(),
+                  fill_block<T>(first, n, value, blocks, n * sizeof(T) > thrust::system::detail::internal::streaming_store_threshold));
+}
+
+
+// true when the elements of OutputIterator can be filled through a raw pointer
+template<typename OutputIterator>
+struct use_trivial_fill
+  : thrust::detail::integral_constant<
+      bool,
+      thrust::is_contiguous_iterator<OutputIterator>::value &&
+      thrust::detail::has_trivial_copy_constructor<typename thrust::iterator_value<OutputIterator>::type>::value &&
+      thrust::detail::has_trivial_assign<typename thrust::iterator_value<OutputIterator>::type>::value
+    >
+{};
+
+
+template<typename DerivedPolicy,
+         typename OutputIterator,
+         typename Size,
+         typename T>
+OutputIterator fill_n(execution_policy<DerivedPolicy> &exec,
+                      OutputIterator first,
+                      Size n,
+                      const T &value,
+                      thrust::detail::true_type) // use_trivial_fill
+{
+  typedef typename thrust::iterator_value<OutputIterator>::type value_type;
+
+  if(n <= 0) return first;
+
+  omp::detail::fill_detail::trivial_fill_n(exec,
+                                           thrust::detail::contiguous_iterator_raw_pointer_cast(first),
+                                           static_cast<std::ptrdiff_t>(n),
+                                           static_cast<value_type>(value));
+
+  return first + n;
+} // end fill_n()
+
+
+template<typename DerivedPolicy,
+         typename OutputIterator,
+         typename Size,
+         typename T>
+OutputIterator fill_n(execution_policy<DerivedPolicy> &exec,
+                      OutputIterator first,
+                      Size n,
+                      const T &value,
+                      thrust::detail::false_type) // use_trivial_fill
+{
+  return thrust::system::detail::generic::fill_n(exec, first, n, value);
+} // end fill_n()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename T>
+void fill(execution_policy<DerivedPolicy> &exec,
+          ForwardIterator first,
+          ForwardIterator last,
+          const T &value,
+          thrust::detail::true_type) // use_trivial_fill
+{
+  omp::detail::fill_detail::fill_n(exec, first, thrust::distance(first, last), value, thrust::detail::true_type());
+} // end fill()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename T>
+void fill(execution_policy<DerivedPolicy> &exec,
+          ForwardIterator first,
+          ForwardIterator last,
+          const T &value,
+          thrust::detail::false_type) // use_trivial_fill
+{
+  thrust::system::detail::generic::fill(exec, first, last, value);
+} // end fill()
+
+
+} // end fill_detail
+
+
+template<typename DerivedPolicy,
+         typename OutputIterator,
+         typename Size,
+         typename T>
+OutputIterator fill_n(execution_policy<DerivedPolicy> &exec,
+                      OutputIterator first,
+                      Size n,
+                      const T &value)
+{
+  return thrust::system::omp::detail::fill_detail::fill_n(exec, first, n, value,
+    typename fill_detail::use_trivial_fill<OutputIterator>::type());
+} // end fill_n()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename T>
+void fill(execution_policy<DerivedPolicy> &exec,
+          ForwardIterator first,
+          ForwardIterator last,
+          const T &value)
+{
+  thrust::system::omp::detail::fill_detail::fill(exec, first, last, value,
+    typename fill_detail::use_trivial_fill<ForwardIterator>::type());
+} // end fill()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
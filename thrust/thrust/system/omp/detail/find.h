@@ -30,8 +30,16 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/find.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/num_threads.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/parallel_find_if.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/find.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -47,8 +55,34 @@ InputIterator find_if(execution_policy<DerivedPolicy> &exec,
                       InputIterator last,
                       Predicate pred)
 {
-  // omp prefers generic::find_if to cpp::find_if
-  return thrust::system::detail::generic::find_if(exec, first, last, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<InputIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type n = last - first;
+
+  const difference_type num_workers = default_decomposition(n).size();
+
+  if(num_workers <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::find_algorithm, value_type>(exec, n))
+  {
+    return thrust::find_if(thrust::seq, first, last, pred);
+  }
+
+  // the threads stop claiming input once one of them finds a match before it
+  return thrust::system::detail::internal::parallel_find_if(for_each_tile(), first, n, num_workers, pred);
 }
 
 } // end namespace detail
@@ -29,8 +29,11 @@
 #include <thrust/detail/static_assert.h>
 #include <thrust/distance.h>
 #include <thrust/for_each.h>
+#include <thrust/detail/seq.h>
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/omp/detail/num_threads.h>
+#include <thrust/system/omp/detail/schedule.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -39,12 +42,34 @@ namespace omp
 {
 namespace detail
 {
+namespace for_each_detail
+{
+
+template<typename RandomAccessIterator, typename UnaryFunction>
+struct for_each_body
+{
+  RandomAccessIterator                                 first;
+  thrust::detail::wrapped_function<UnaryFunction,void> wrapped_f;
+
+  for_each_body(RandomAccessIterator first, UnaryFunction f)
+    : first(first), wrapped_f(f)
+  {}
+
+  template<typename DifferenceType>
+  void operator()(DifferenceType i) const
+  {
+    RandomAccessIterator temp = first + i;
+    wrapped_f(*temp);
+  }
+};
+
+} // end namespace for_each_detail
 
 template<typename DerivedPolicy,
          typename RandomAccessIterator,
          typename Size,
          typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy> &,
+RandomAccessIterator for_each_n(execution_policy<DerivedPolicy> &exec,
                                 RandomAccessIterator first,
                                 Size n,
                                 UnaryFunction f)
@@ -61,24 +86,26 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy> &,
   , "OpenMP compiler support is not enabled"
   );
 
-  if (n <= 0) return first;  //empty range
+  num_threads_guard guard(exec);
 
-  // create a wrapped function for f
-  thrust::detail::wrapped_function<UnaryFunction,void> wrapped_f(f);
+  if (n <= 0) return first;  //empty range
 
   // use a signed type for the iteration variable or suffer the consequences of warnings
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      ValueType;
   typedef typename thrust::iterator_difference<RandomAccessIterator>::type DifferenceType;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for(DifferenceType i = 0;
-      i < signed_n;
-      ++i)
+  if (thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::for_each_algorithm, ValueType>(exec, signed_n))
   {
-    RandomAccessIterator temp = first + i;
-    wrapped_f(*temp);
+    // don't bother opening a parallel region for small n
+    return thrust::for_each_n(thrust::seq, first, n, f);
   }
 
+  // hand out the iterations as the policy's schedule asks
+  omp::detail::parallel_for(omp::detail::schedule_of(exec),
+                            signed_n,
+                            for_each_detail::for_each_body<RandomAccessIterator,UnaryFunction>(first, f));
+
   return first + n;
 } // end for_each_n()
 
@@ -25,7 +25,56 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/pair.h>
 
-// this system inherits merge
-#include <thrust/system/cpp/detail/merge.h>
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
 
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator merge(execution_policy<DerivedPolicy> &exec,
+                     InputIterator1 first1,
+                     InputIterator1 last1,
+                     InputIterator2 first2,
+                     InputIterator2 last2,
+                     OutputIterator result,
+                     StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename InputIterator4,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+  merge_by_key(execution_policy<DerivedPolicy> &exec,
+               InputIterator1 keys_first1,
+               InputIterator1 keys_last1,
+               InputIterator2 keys_first2,
+               InputIterator2 keys_last2,
+               InputIterator3 values_first1,
+               InputIterator4 values_first2,
+               OutputIterator1 keys_result,
+               OutputIterator2 values_result,
+               StrictWeakOrdering comp);
+
+
+} // end detail
+} // end omp
+} // end system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/omp/detail/merge.inl>
@@ -0,0 +1,259 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
+#include <thrust/system/omp/detail/num_threads.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/merge.h>
+#include <thrust/detail/seq.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+namespace merge_detail
+{
+
+
+// merges the part of the output which lies in one tile
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+struct merge_tile
+{
+  InputIterator1 first1;
+  Size n1;
+  InputIterator2 first2;
+  Size n2;
+  OutputIterator result;
+  thrust::system::detail::internal::uniform_decomposition<Size> tiles;
+  StrictWeakOrdering comp;
+
+  merge_tile(InputIterator1 first1, Size n1,
+             InputIterator2 first2, Size n2,
+             OutputIterator result,
+             thrust::system::detail::internal::uniform_decomposition<Size> tiles,
+             StrictWeakOrdering comp)
+    : first1(first1), n1(n1), first2(first2), n2(n2), result(result), tiles(tiles), comp(comp)
+  {}
+
+  void operator()(Size tile) const
+  {
+    Size begin = tiles[tile].begin();
+    Size end   = tiles[tile].end();
+
+    Size begin1 = thrust::system::detail::internal::merge_path(first1, n1, first2, n2, begin, comp);
+    Size end1   = thrust::system::detail::internal::merge_path(first1, n1, first2, n2, end,   comp);
+
+    thrust::merge(thrust::seq,
+                  first1 + begin1,           first1 + end1,
+                  first2 + (begin - begin1), first2 + (end - end1),
+                  result + begin,
+                  comp);
+  }
+};
+
+
+// merges the part of the output which lies in one tile
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename InputIterator4,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+struct merge_by_key_tile
+{
+  InputIterator1 keys_first1;
+  Size n1;
+  InputIterator2 keys_first2;
+  Size n2;
+  InputIterator3 values_first1;
+  InputIterator4 values_first2;
+  OutputIterator1 keys_result;
+  OutputIterator2 values_result;
+  thrust::system::detail::internal::uniform_decomposition<Size> tiles;
+  StrictWeakOrdering comp;
+
+  merge_by_key_tile(InputIterator1 keys_first1, Size n1,
+                    InputIterator2 keys_first2, Size n2,
+                    InputIterator3 values_first1,
+                    InputIterator4 values_first2,
+                    OutputIterator1 keys_result,
+                    OutputIterator2 values_result,
+                    thrust::system::detail::internal::uniform_decomposition<Size> tiles,
+                    StrictWeakOrdering comp)
+    : keys_first1(keys_first1), n1(n1), keys_first2(keys_first2), n2(n2),
+      values_first1(values_first1), values_first2(values_first2),
+      keys_result(keys_result), values_result(values_result),
+      tiles(tiles), comp(comp)
+  {}
+
+  void operator()(Size tile) const
+  {
+    Size begin = tiles[tile].begin();
+    Size end   = tiles[tile].end();
+
+    Size begin1 = thrust::system::detail::internal::merge_path(keys_first1, n1, keys_first2, n2, begin, comp);
+    Size end1   = thrust::system::detail::internal::merge_path(keys_first1, n1, keys_first2, n2, end,   comp);
+
+    thrust::merge_by_key(thrust::seq,
+                         keys_first1 + begin1,           keys_first1 + end1,
+                         keys_first2 + (begin - begin1), keys_first2 + (end - end1),
+                         values_first1 + begin1,
+                         values_first2 + (begin - begin1),
+                         keys_result + begin,
+                         values_result + begin,
+                         comp);
+  }
+};
+
+
+} // end merge_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator merge(execution_policy<DerivedPolicy> &exec,
+                     InputIterator1 first1,
+                     InputIterator1 last1,
+                     InputIterator2 first2,
+                     InputIterator2 last2,
+                     OutputIterator result,
+                     StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<InputIterator1>::type      ValueType;
+  typedef typename thrust::iterator_difference<InputIterator1>::type IndexType;
+
+  const IndexType n1 = last1 - first1;
+  const IndexType n2 = last2 - first2;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = default_decomposition(n1 + n2);
+
+  if(decomp.size() <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::merge_algorithm, ValueType>(exec, n1 + n2))
+  {
+    return thrust::merge(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+
+  // every tile of the output is an independent merge of the inputs' cuts at its ends
+  for_each_tile()(decomp.size(),
+                  merge_detail::merge_tile<InputIterator1,InputIterator2,OutputIterator,IndexType,StrictWeakOrdering>
+                    (first1, n1, first2, n2, result, decomp, comp));
+
+  return result + (n1 + n2);
+} // end merge()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename InputIterator4,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+  merge_by_key(execution_policy<DerivedPolicy> &exec,
+               InputIterator1 keys_first1,
+               InputIterator1 keys_last1,
+               InputIterator2 keys_first2,
+               InputIterator2 keys_last2,
+               InputIterator3 values_first1,
+               InputIterator4 values_first2,
+               OutputIterator1 keys_result,
+               OutputIterator2 values_result,
+               StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<InputIterator1>::type      ValueType;
+  typedef typename thrust::iterator_difference<InputIterator1>::type IndexType;
+
+  const IndexType n1 = keys_last1 - keys_first1;
+  const IndexType n2 = keys_last2 - keys_first2;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = default_decomposition(n1 + n2);
+
+  if(decomp.size() <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::merge_algorithm, ValueType>(exec, n1 + n2))
+  {
+    return thrust::merge_by_key(thrust::seq, keys_first1, keys_last1, keys_first2, keys_last2, values_first1, values_first2, keys_result, values_result, comp);
+  }
+
+  // every tile of the output is an independent merge of the inputs' cuts at its ends
+  for_each_tile()(decomp.size(),
+                  merge_detail::merge_by_key_tile<InputIterator1,InputIterator2,InputIterator3,InputIterator4,OutputIterator1,OutputIterator2,IndexType,StrictWeakOrdering>
+                    (keys_first1, n1, keys_first2, n2, values_first1, values_first2, keys_result, values_result, decomp, comp));
+
+  return thrust::make_pair(keys_result + (n1 + n2), values_result + (n1 + n2));
+} // end merge_by_key()
+
+
+} // end detail
+} // end omp
+} // end system
+THRUST_NAMESPACE_END
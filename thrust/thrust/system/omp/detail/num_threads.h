@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file num_threads.h
+ *  \brief The number of threads the OpenMP backend's parallel regions use.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+// fallback for policies which don't carry a number of threads; zero leaves the
+// choice to the OpenMP runtime
+template<typename DerivedPolicy>
+int get_num_threads(execution_policy<DerivedPolicy> &)
+{
+  return 0;
+}
+
+
+// entry point
+template<typename DerivedPolicy>
+int num_threads_of(execution_policy<DerivedPolicy> &exec)
+{
+  return get_num_threads(thrust::detail::derived_cast(exec));
+}
+
+
+// Makes the parallel regions which the calling thread opens during its
+// lifetime use the number of threads exec asks for. An algorithm creates one
+// on entry, before it picks its decomposition, which is sized after
+// omp_get_max_threads().
+class num_threads_guard
+{
+public:
+  template<typename DerivedPolicy>
+  explicit num_threads_guard(execution_policy<DerivedPolicy> &exec)
+    : saved_num_threads(0)
+  {
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    const int num_threads = num_threads_of(exec);
+
+    if(num_threads > 0)
+    {
+      saved_num_threads = omp_get_max_threads();
+      omp_set_num_threads(num_threads);
+    }
+#else
+    (void) exec;
+#endif
+  }
+
+  // the same for a number of threads given directly, where zero leaves the
+  // choice to the OpenMP runtime
+  explicit num_threads_guard(int num_threads)
+    : saved_num_threads(0)
+  {
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    if(num_threads > 0)
+    {
+      saved_num_threads = omp_get_max_threads();
+      omp_set_num_threads(num_threads);
+    }
+#else
+    (void) num_threads;
+#endif
+  }
+
+  ~num_threads_guard()
+  {
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    if(saved_num_threads > 0)
+    {
+      omp_set_num_threads(saved_num_threads);
+    }
+#endif
+  }
+
+private:
+  int saved_num_threads;
+
+  num_threads_guard(const num_threads_guard &);
+  num_threads_guard &operator=(const num_threads_guard &);
+};
+
+
+} // end detail
+} // end omp
+} // end system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,148 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file numa_resource.h
+ *  \brief A memory resource which decides on which NUMA nodes the pages of
+ *         its large allocations live.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+
+#include <cstddef>
+#include <new>
+
+#if defined(__linux__)
+#  include <linux/mempolicy.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+// where the pages of a large allocation live on a host with several NUMA nodes
+enum numa_placement
+{
+  // on the node of the thread which first touches each page; the parallel
+  // algorithms which initialize the omp containers touch them with the same
+  // decomposition as the algorithms which later read them
+  numa_first_touch,
+
+  // round robin over the nodes the process may allocate on, for data which
+  // every thread reads
+  numa_interleaved
+};
+
+
+// Allocates large blocks as fresh pages straight from the operating system,
+// whose nodes are chosen when they're first touched rather than by whichever
+// thread last touched a recycled block of the heap, and hands smaller blocks
+// to new_delete_resource. Interleaved placement is requested with mbind where
+// the host has it, and is only a hint: hosts which refuse it allocate the
+// pages where they like.
+template<numa_placement Placement>
+class numa_resource final : public thrust::mr::memory_resource<>
+{
+public:
+  // blocks smaller than this span too few pages to be worth mapping
+  static const std::size_t min_mapped_bytes = 1 << 20;
+
+  void *do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+#if defined(__linux__)
+    if(is_mapped(bytes, alignment))
+    {
+      void *p = ::mmap(0, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+      if(p == MAP_FAILED)
+      {
+        throw std::bad_alloc();
+      }
+
+      if(Placement == numa_interleaved)
+      {
+        interleave(p, bytes);
+      }
+
+      return p;
+    }
+#endif
+
+    return upstream.do_allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void *p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+#if defined(__linux__)
+    if(is_mapped(bytes, alignment))
+    {
+      ::munmap(p, bytes);
+      return;
+    }
+#endif
+
+    upstream.do_deallocate(p, bytes, alignment);
+  }
+
+private:
+  thrust::mr::new_delete_resource upstream;
+
+#if defined(__linux__)
+  static bool is_mapped(std::size_t bytes, std::size_t alignment)
+  {
+    return bytes >= min_mapped_bytes && alignment <= static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  }
+
+  // spreads the pages of [p, p + bytes) over the nodes the process may use
+  static void interleave(void *p, std::size_t bytes)
+  {
+    const unsigned long max_nodes = 1024;
+
+    unsigned long nodes[max_nodes / (8 * sizeof(unsigned long))] = {};
+
+    if(::syscall(SYS_get_mempolicy, 0, nodes, max_nodes, 0, MPOL_F_MEMS_ALLOWED) == 0)
+    {
+      ::syscall(SYS_mbind, p, bytes, MPOL_INTERLEAVE, nodes, max_nodes, 0);
+    }
+  }
+#endif
+};
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -26,7 +26,15 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#if _CCCL_STD_VER >= 2011
+#  include <thrust/detail/dependencies_aware_execution_policy.h>
+#endif
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/omp/detail/num_threads.h>
+#include <thrust/system/omp/detail/schedule.h>
+
+#include <cstddef>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -37,12 +45,98 @@ namespace detail
 {
 
 
+// an omp policy carrying the loop schedule and the number of threads its
+// algorithms use, and the input size below which they run sequentially
+template<typename Derived>
+struct execute_with_options_base : thrust::system::omp::detail::execution_policy<Derived>
+{
+private:
+  loop_schedule sched;
+  int           num_threads;
+  std::size_t   min_size;
+
+public:
+  _CCCL_HOST_DEVICE
+  constexpr execute_with_options_base(loop_schedule sched_ = loop_schedule(), int num_threads_ = 0, std::size_t min_size_ = 0)
+    : sched(sched_), num_threads(num_threads_), min_size(min_size_)
+  {}
+
+  Derived schedule(schedule_kind kind, int chunk_size = 0) const
+  {
+    Derived result = thrust::detail::derived_cast(*this);
+    result.sched   = loop_schedule(kind, chunk_size);
+    return result;
+  }
+
+  Derived on(int num_threads_) const
+  {
+    Derived result     = thrust::detail::derived_cast(*this);
+    result.num_threads = num_threads_;
+    return result;
+  }
+
+  Derived min_parallel_size(std::size_t n) const
+  {
+    Derived result  = thrust::detail::derived_cast(*this);
+    result.min_size = n;
+    return result;
+  }
+
+private:
+  friend loop_schedule get_schedule(const execute_with_options_base &exec)
+  {
+    return exec.sched;
+  }
+
+  friend int get_num_threads(const execute_with_options_base &exec)
+  {
+    return exec.num_threads;
+  }
+
+  friend std::size_t get_min_parallel_size(const execute_with_options_base &exec)
+  {
+    return exec.min_size;
+  }
+};
+
+
+struct execute_with_options : execute_with_options_base<execute_with_options>
+{
+  typedef execute_with_options_base<execute_with_options> base_t;
+
+  _CCCL_HOST_DEVICE
+  constexpr execute_with_options() : base_t() {}
+
+  _CCCL_HOST_DEVICE
+  constexpr execute_with_options(loop_schedule sched, int num_threads, std::size_t min_size = 0) : base_t(sched, num_threads, min_size) {}
+};
+
+
 struct par_t : thrust::system::omp::detail::execution_policy<par_t>,
   thrust::detail::allocator_aware_execution_policy<
-    thrust::system::omp::detail::execution_policy>
+    execute_with_options_base>
+#if _CCCL_STD_VER >= 2011
+, thrust::detail::dependencies_aware_execution_policy<
+    execute_with_options_base>
+#endif
 {
   _CCCL_HOST_DEVICE
   constexpr par_t() : thrust::system::omp::detail::execution_policy<par_t>() {}
+
+  execute_with_options schedule(schedule_kind kind, int chunk_size = 0) const
+  {
+    return execute_with_options(loop_schedule(kind, chunk_size), 0);
+  }
+
+  execute_with_options on(int num_threads) const
+  {
+    return execute_with_options(loop_schedule(), num_threads);
+  }
+
+  execute_with_options min_parallel_size(std::size_t n) const
+  {
+    return execute_with_options(loop_schedule(), 0, n);
+  }
 };
 
 
@@ -31,7 +31,16 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/omp/detail/partition.h>
-#include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/omp/detail/stream_compaction.h>
+#include <thrust/system/omp/detail/num_threads.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/parallel_stable_partition.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/partition.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -50,8 +59,34 @@ template<typename DerivedPolicy,
                                    ForwardIterator last,
                                    Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      ForwardIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<ForwardIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = default_decomposition(n);
+
+  if(decomp.size() <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::partition_algorithm, ValueType>(exec, n))
+  {
+    return thrust::stable_partition(thrust::seq, first, last, pred);
+  }
+
+  // the input doubles as its own stencil
+  return thrust::system::detail::internal::parallel_stable_partition(exec, for_each_tile(), first, first, n, decomp.size(), pred);
 } // end stable_partition()
 
 
@@ -65,8 +100,34 @@ template<typename DerivedPolicy,
                                    InputIterator stencil,
                                    Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      ForwardIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<ForwardIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = default_decomposition(n);
+
+  if(decomp.size() <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::partition_algorithm, ValueType>(exec, n))
+  {
+    return thrust::stable_partition(thrust::seq, first, last, stencil, pred);
+  }
+
+  // only the false elements are buffered, rather than a copy of the whole input
+  return thrust::system::detail::internal::parallel_stable_partition(exec, for_each_tile(), first, stencil, n, decomp.size(), pred);
 } // end stable_partition()
 
 
@@ -83,8 +144,7 @@ template<typename DerivedPolicy,
                           OutputIterator2 out_false,
                           Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  return thrust::system::omp::detail::stable_partition_copy(exec, first, last, first, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 
@@ -103,8 +163,8 @@ template<typename DerivedPolicy,
                           OutputIterator2 out_false,
                           Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  // partition both outputs in a single sweep
+  return thrust::system::omp::detail::stream_compaction(exec, first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 
@@ -42,9 +42,9 @@
 // directives.
 // WAR this by using the MSVC-extension `__pragma`. See this link for more info:
 // https://developercommunity.visualstudio.com/t/Using-C11s-_Pragma-with-OpenMP-dire/1590628
-#define THRUST_PRAGMA_OMP_IMPL(directive) __pragma(directive)
+#define THRUST_PRAGMA_OMP_IMPL(...) __pragma(__VA_ARGS__)
 #else // Not MSVC:
-#define THRUST_PRAGMA_OMP_IMPL(directive) _Pragma(#directive)
+#define THRUST_PRAGMA_OMP_IMPL(...) _Pragma(#__VA_ARGS__)
 #endif
 
 // For internal use only -- THRUST_PRAGMA_OMP is used to switch between
@@ -55,10 +55,12 @@
 //   Replace: #pragma omp parallel for
 //   With   : THRUST_PRAGMA_OMP(parallel for)
 //
+// The directive may contain commas, e.g. THRUST_PRAGMA_OMP(parallel for schedule(dynamic, 4)).
+//
 #if defined(_NVHPC_STDPAR_OPENMP) && _NVHPC_STDPAR_OPENMP == 1
-#define THRUST_PRAGMA_OMP(directive) THRUST_PRAGMA_OMP_IMPL(omp_stdpar directive)
+#define THRUST_PRAGMA_OMP(...) THRUST_PRAGMA_OMP_IMPL(omp_stdpar __VA_ARGS__)
 #elif defined(_OPENMP)
-#define THRUST_PRAGMA_OMP(directive) THRUST_PRAGMA_OMP_IMPL(omp directive)
+#define THRUST_PRAGMA_OMP(...) THRUST_PRAGMA_OMP_IMPL(omp __VA_ARGS__)
 #else
-#define THRUST_PRAGMA_OMP(directive)
+#define THRUST_PRAGMA_OMP(...)
 #endif
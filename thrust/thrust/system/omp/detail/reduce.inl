@@ -27,8 +27,22 @@
 #endif // no system header
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/reduce.h>
+#include <thrust/system/omp/detail/num_threads.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/system/omp/detail/schedule.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <cstddef>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -37,25 +51,151 @@ namespace omp
 {
 namespace detail
 {
+namespace reduce_detail
+{
 
 
-template<typename DerivedPolicy,
-         typename InputIterator,
-         typename OutputType,
-         typename BinaryFunction>
-  OutputType reduce(execution_policy<DerivedPolicy> &exec,
-                    InputIterator first,
-                    InputIterator last,
-                    OutputType init,
-                    BinaryFunction binary_op)
+// the most partial sums which are kept on the stack rather than the heap
+const static int max_stack_partials = 256;
+
+
+// a partial sum on a cache line of its own, so that the partials of
+// different threads don't share one
+template<typename T>
+struct alignas(64) padded_partial
 {
-  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+  T value;
+};
+
+
+// whether binary_op over T has a matching OpenMP reduction clause, which the
+// compiler may vectorize
+template<typename BinaryFunction, typename T>
+struct has_simd_reduction : thrust::detail::false_type {};
+
+template<typename T>
+struct has_simd_reduction<thrust::plus<T>,T> : thrust::detail::is_arithmetic<T> {};
+
+template<typename T>
+struct has_simd_reduction<thrust::minimum<T>,T> : thrust::detail::is_integral<T> {};
+
+template<typename T>
+struct has_simd_reduction<thrust::maximum<T>,T> : thrust::detail::is_integral<T> {};
+
+
+// folds [first, last) into sum
+template<typename InputIterator, typename OutputType, typename BinaryFunction>
+OutputType reduce_range(InputIterator first, InputIterator last, OutputType sum, BinaryFunction binary_op, thrust::detail::false_type)
+{
+  thrust::detail::wrapped_function<BinaryFunction,OutputType> wrapped_binary_op(binary_op);
+
+  for(; first != last; ++first)
+  {
+    sum = wrapped_binary_op(sum, *first);
+  }
+
+  return sum;
+}
+
+
+// the same, vectorized for the operators in has_simd_reduction over raw
+// pointers; OpenMP 4.0 introduced the simd construct
+#if defined(_OPENMP) && (_OPENMP >= 201307)
+#  define THRUST_OMP_REDUCE_SIMD(clause) THRUST_PRAGMA_OMP(simd reduction(clause))
+#else
+#  define THRUST_OMP_REDUCE_SIMD(clause)
+#endif
+
+template<typename Pointer, typename T>
+T reduce_range(Pointer first, Pointer last, T sum, thrust::plus<T>, thrust::detail::true_type)
+{
+  const std::ptrdiff_t n = last - first;
+
+  THRUST_OMP_REDUCE_SIMD(+:sum)
+  for(std::ptrdiff_t i = 0; i < n; ++i)
+  {
+    sum += first[i];
+  }
+
+  return sum;
+}
+
+template<typename Pointer, typename T>
+T reduce_range(Pointer first, Pointer last, T sum, thrust::minimum<T>, thrust::detail::true_type)
+{
+  const std::ptrdiff_t n = last - first;
+
+  THRUST_OMP_REDUCE_SIMD(min:sum)
+  for(std::ptrdiff_t i = 0; i < n; ++i)
+  {
+    sum = first[i] < sum ? first[i] : sum;
+  }
+
+  return sum;
+}
+
+template<typename Pointer, typename T>
+T reduce_range(Pointer first, Pointer last, T sum, thrust::maximum<T>, thrust::detail::true_type)
+{
+  const std::ptrdiff_t n = last - first;
+
+  THRUST_OMP_REDUCE_SIMD(max:sum)
+  for(std::ptrdiff_t i = 0; i < n; ++i)
+  {
+    sum = sum < first[i] ? first[i] : sum;
+  }
+
+  return sum;
+}
+
+#undef THRUST_OMP_REDUCE_SIMD
 
-  const difference_type n = thrust::distance(first,last);
 
-  // determine first and second level decomposition
-  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp1 = thrust::system::omp::detail::default_decomposition(n);
-  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp2(decomp1.size() + 1, 1, 1);
+// reduces interval i of decomp into partials[i]
+template<typename InputIterator, typename OutputType, typename BinaryFunction, typename Decomposition>
+struct reduce_partial
+{
+  typedef thrust::detail::integral_constant<
+    bool,
+    has_simd_reduction<BinaryFunction,OutputType>::value &&
+    thrust::detail::is_pointer<InputIterator>::value &&
+    thrust::detail::is_same<typename thrust::iterator_value<InputIterator>::type, OutputType>::value
+  > use_simd;
+
+  InputIterator               input;
+  BinaryFunction              binary_op;
+  Decomposition               decomp;
+  padded_partial<OutputType> *partials;
+
+  reduce_partial(InputIterator input, BinaryFunction binary_op, Decomposition decomp, padded_partial<OutputType> *partials)
+    : input(input), binary_op(binary_op), decomp(decomp), partials(partials)
+  {}
+
+  template<typename IndexType>
+  void operator()(IndexType i) const
+  {
+    // intervals are never empty
+    InputIterator begin = input + decomp[i].begin();
+    InputIterator end   = input + decomp[i].end();
+
+    OutputType sum = thrust::raw_reference_cast(*begin);
+
+    partials[i].value = reduce_range(begin + 1, end, sum, binary_op, use_simd());
+  }
+};
+
+
+// reduces each interval of decomp into temporary storage, then the partial
+// sums in order from init
+template<typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction, typename Decomposition>
+OutputType two_level_reduce(execution_policy<DerivedPolicy> &exec,
+                            InputIterator first,
+                            OutputType init,
+                            BinaryFunction binary_op,
+                            Decomposition decomp1,
+                            thrust::detail::false_type)
+{
+  Decomposition decomp2(decomp1.size() + 1, 1, 1);
 
   // allocate storage for the initializer and partial sums
   // XXX use select_system for Tag
@@ -71,6 +211,86 @@ template<typename DerivedPolicy,
   thrust::system::omp::detail::reduce_intervals(exec, partial_sums.begin(), partial_sums.begin(), binary_op, decomp2);
 
   return partial_sums[0];
+}
+
+
+// the same for arithmetic types, with the partial sums on the stack, one
+// cache line apiece, and reduced without a second parallel region
+template<typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction, typename Decomposition>
+OutputType two_level_reduce(execution_policy<DerivedPolicy> &exec,
+                            InputIterator first,
+                            OutputType init,
+                            BinaryFunction binary_op,
+                            Decomposition decomp1,
+                            thrust::detail::true_type)
+{
+  if(decomp1.size() > max_stack_partials)
+  {
+    return two_level_reduce(exec, first, init, binary_op, decomp1, thrust::detail::false_type());
+  }
+
+  typedef thrust::detail::try_unwrap_contiguous_iterator_return_t<InputIterator> Iterator;
+
+  padded_partial<OutputType> partials[max_stack_partials];
+
+  omp::detail::parallel_for(schedule_of(exec),
+                            decomp1.size(),
+                            reduce_partial<Iterator,OutputType,BinaryFunction,Decomposition>
+                              (thrust::detail::try_unwrap_contiguous_iterator(first), binary_op, decomp1, partials));
+
+  thrust::detail::wrapped_function<BinaryFunction,OutputType> wrapped_binary_op(binary_op);
+
+  for(typename Decomposition::index_type i = 0; i < decomp1.size(); ++i)
+  {
+    init = wrapped_binary_op(init, partials[i].value);
+  }
+
+  return init;
+}
+
+
+} // end namespace reduce_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputType,
+         typename BinaryFunction>
+  OutputType reduce(execution_policy<DerivedPolicy> &exec,
+                    InputIterator first,
+                    InputIterator last,
+                    OutputType init,
+                    BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<InputIterator>::type      InputType;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type n = thrust::distance(first,last);
+
+  if(thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::reduce_algorithm, InputType>(exec, n))
+  {
+    // don't bother opening a parallel region for small n
+    return thrust::reduce(thrust::seq, first, last, init, binary_op);
+  }
+
+  // determine first level decomposition
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp1 = thrust::system::omp::detail::default_decomposition(n, schedule_of(exec));
+
+  return reduce_detail::two_level_reduce(exec, first, init, binary_op, decomp1, thrust::detail::is_arithmetic<OutputType>());
 } // end reduce()
 
 
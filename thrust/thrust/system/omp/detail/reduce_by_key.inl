@@ -26,8 +26,15 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/omp/detail/reduce_by_key.h>
-#include <thrust/system/detail/generic/reduce_by_key.h>
-#include <thrust/distance.h>
+#include <thrust/system/omp/detail/num_threads.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/parallel_reduce_by_key.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/reduce.h>
+#include <thrust/detail/seq.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -54,8 +61,38 @@ template <typename DerivedPolicy,
                   BinaryPredicate binary_pred,
                   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<InputIterator2>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator1>::type difference_type;
+
+  const difference_type n = keys_last - keys_first;
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = default_decomposition(n);
+
+  // a single interval has no parallelism to exploit, and a short input
+  // isn't worth a parallel region
+  if(decomp.size() <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::reduce_by_key_algorithm, value_type>(exec, n))
+  {
+    return thrust::reduce_by_key(thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+
+  // segments which span intervals are carried from one interval into the
+  // next, so the temporary storage is per interval rather than per element
+  return thrust::system::detail::internal::parallel_reduce_by_key(exec, for_each_tile(), keys_first, values_first, keys_output, values_output,
+                                                                  n, decomp.size(), binary_pred, binary_op);
 } // end reduce_by_key()
 
 
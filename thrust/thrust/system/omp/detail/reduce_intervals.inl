@@ -26,9 +26,11 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/system/omp/detail/num_threads.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/function.h>
 #include <thrust/detail/cstdint.h>
+#include <thrust/system/omp/detail/schedule.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -37,42 +39,33 @@ namespace omp
 {
 namespace detail
 {
+namespace reduce_intervals_detail
+{
 
-template <typename DerivedPolicy,
-          typename InputIterator,
+
+// reduces interval i of decomp into output[i]
+template <typename InputIterator,
           typename OutputIterator,
           typename BinaryFunction,
           typename Decomposition>
-void reduce_intervals(execution_policy<DerivedPolicy> &,
-                      InputIterator input,
-                      OutputIterator output,
-                      BinaryFunction binary_op,
-                      Decomposition decomp)
+struct reduce_interval
 {
-  // we're attempting to launch an omp kernel, assert we're compiling with omp support
-  // ========================================================================
-  // X Note to the user: If you've found this line due to a compiler error, X
-  // X you need to enable OpenMP support in your compiler.                  X
-  // ========================================================================
-  THRUST_STATIC_ASSERT_MSG(
-    (thrust::detail::depend_on_instantiation<
-      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-    >::value)
-  , "OpenMP compiler support is not enabled"
-  );
-
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   typedef typename thrust::iterator_value<OutputIterator>::type OutputType;
 
-  // wrap binary_op
-  thrust::detail::wrapped_function<BinaryFunction,OutputType> wrapped_binary_op(binary_op);
+  InputIterator                                              input;
+  OutputIterator                                             output;
+  thrust::detail::wrapped_function<BinaryFunction,OutputType> wrapped_binary_op;
+  Decomposition                                              decomp;
 
-  typedef thrust::detail::intptr_t index_type;
-
-  index_type n = static_cast<index_type>(decomp.size());
+  reduce_interval(InputIterator input,
+                  OutputIterator output,
+                  BinaryFunction binary_op,
+                  Decomposition decomp)
+    : input(input), output(output), wrapped_binary_op(binary_op), decomp(decomp)
+  {}
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for(index_type i = 0; i < n; i++)
+  template <typename IndexType>
+  void operator()(IndexType i) const
   {
     InputIterator begin = input + decomp[i].begin();
     InputIterator end   = input + decomp[i].end();
@@ -93,6 +86,47 @@ void reduce_intervals(execution_policy<DerivedPolicy> &,
       *tmp = sum;
     }
   }
+};
+
+
+} // end namespace reduce_intervals_detail
+
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinaryFunction,
+          typename Decomposition>
+void reduce_intervals(execution_policy<DerivedPolicy> &exec,
+                      InputIterator input,
+                      OutputIterator output,
+                      BinaryFunction binary_op,
+                      Decomposition decomp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef thrust::detail::intptr_t index_type;
+
+  index_type n = static_cast<index_type>(decomp.size());
+
+  // hand out the intervals as the policy's schedule asks
+  omp::detail::parallel_for(omp::detail::schedule_of(exec),
+                            n,
+                            reduce_intervals_detail::reduce_interval<InputIterator,OutputIterator,BinaryFunction,Decomposition>
+                              (input, output, binary_op, decomp));
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
@@ -27,6 +27,8 @@
 #endif // no system header
 #include <thrust/system/omp/detail/remove.h>
 #include <thrust/system/detail/generic/remove.h>
+#include <thrust/system/omp/detail/stream_compaction.h>
+#include <thrust/iterator/discard_iterator.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -74,8 +76,7 @@ template<typename DerivedPolicy,
                                 OutputIterator result,
                                 Predicate pred)
 {
-  // omp prefers generic::remove_copy_if to cpp::remove_copy_if
-  return thrust::system::detail::generic::remove_copy_if(exec, first, last, result, pred);
+  return thrust::system::omp::detail::remove_copy_if(exec, first, last, first, result, pred);
 }
 
 template<typename DerivedPolicy,
@@ -90,8 +91,8 @@ template<typename DerivedPolicy,
                                 OutputIterator result,
                                 Predicate pred)
 {
-  // omp prefers generic::remove_copy_if to cpp::remove_copy_if
-  return thrust::system::detail::generic::remove_copy_if(exec, first, last, stencil, result, pred);
+  // compact the false elements to result and discard the rest
+  return thrust::system::omp::detail::stream_compaction(exec, first, last, stencil, thrust::make_discard_iterator(), result, pred).second;
 }
 
 } // end namespace detail
@@ -0,0 +1,266 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/omp/detail/scan.h>
+#include <thrust/system/omp/detail/num_threads.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/seq.h>
+#include <thrust/distance.h>
+#include <thrust/scan.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_detail
+{
+
+
+// reduce the non-empty range [first, last)
+template<typename ValueType,
+         typename InputIterator,
+         typename BinaryFunction>
+  ValueType reduce_interval(InputIterator first,
+                            InputIterator last,
+                            BinaryFunction binary_op)
+{
+  ValueType sum = *first;
+
+  for(++first; first != last; ++first)
+    sum = binary_op(sum, *first);
+
+  return sum;
+}
+
+
+// inclusive scan of [first, last) which folds in the sum of all preceding intervals
+template<typename InputIterator,
+         typename OutputIterator,
+         typename ValueType,
+         typename BinaryFunction>
+  void inclusive_scan_with_carry(InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator result,
+                                 ValueType carry,
+                                 BinaryFunction binary_op)
+{
+  for(; first != last; ++first, ++result)
+    *result = carry = binary_op(carry, *first);
+}
+
+
+} // end scan_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  typedef typename thrust::iterator_value<InputIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  // a single interval has no parallelism to exploit, and a short input
+  // isn't worth a parallel region
+  if(decomp.size() <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::scan_algorithm, ValueType>(exec, n))
+  {
+    return thrust::inclusive_scan(thrust::seq, first, last, result, binary_op);
+  }
+
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  // sums[i] holds the reduction of intervals [0, i]
+  // the final interval's sum is never consumed, so don't reserve space for it
+  const difference_type num_intervals = decomp.size();
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> sums(exec, num_intervals - 1);
+
+  THRUST_PRAGMA_OMP(parallel)
+  {
+    // first pass: reduce each interval independently
+    THRUST_PRAGMA_OMP(for)
+    for(difference_type i = 0; i < num_intervals - 1; ++i)
+    {
+      sums[i] = scan_detail::reduce_interval<ValueType>(first + decomp[i].begin(),
+                                                        first + decomp[i].end(),
+                                                        wrapped_binary_op);
+    }
+
+    // scan the interval sums to produce each interval's carry
+    THRUST_PRAGMA_OMP(single)
+    {
+      thrust::inclusive_scan(thrust::seq, sums.begin(), sums.end(), sums.begin(), binary_op);
+    }
+
+    // second pass: scan each interval, seeded with its carry
+    THRUST_PRAGMA_OMP(for)
+    for(difference_type i = 0; i < num_intervals; ++i)
+    {
+      if(i == 0)
+      {
+        thrust::inclusive_scan(thrust::seq,
+                               first + decomp[i].begin(),
+                               first + decomp[i].end(),
+                               result + decomp[i].begin(),
+                               binary_op);
+      }
+      else
+      {
+        scan_detail::inclusive_scan_with_carry(first + decomp[i].begin(),
+                                               first + decomp[i].end(),
+                                               result + decomp[i].begin(),
+                                               static_cast<ValueType>(sums[i - 1]),
+                                               wrapped_binary_op);
+      }
+    }
+  }
+
+  return result + n;
+} // end inclusive_scan()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename InitialValueType,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                InitialValueType init,
+                                BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  // Use the initial value type per https://wg21.link/P0571
+  typedef InitialValueType                                          ValueType;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  // a single interval has no parallelism to exploit, and a short input
+  // isn't worth a parallel region
+  if(decomp.size() <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::scan_algorithm, ValueType>(exec, n))
+  {
+    return thrust::exclusive_scan(thrust::seq, first, last, result, init, binary_op);
+  }
+
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  // carries[0] holds init and carries[i + 1] the reduction of interval i
+  // the final interval's sum is never consumed, so don't reserve space for it
+  const difference_type num_intervals = decomp.size();
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> carries(exec, num_intervals);
+
+  carries[0] = init;
+
+  THRUST_PRAGMA_OMP(parallel)
+  {
+    // first pass: reduce each interval independently
+    THRUST_PRAGMA_OMP(for)
+    for(difference_type i = 0; i < num_intervals - 1; ++i)
+    {
+      carries[i + 1] = scan_detail::reduce_interval<ValueType>(first + decomp[i].begin(),
+                                                               first + decomp[i].end(),
+                                                               wrapped_binary_op);
+    }
+
+    // scan the interval sums to produce each interval's carry
+    THRUST_PRAGMA_OMP(single)
+    {
+      thrust::inclusive_scan(thrust::seq, carries.begin(), carries.end(), carries.begin(), binary_op);
+    }
+
+    // second pass: scan each interval, seeded with its carry
+    THRUST_PRAGMA_OMP(for)
+    for(difference_type i = 0; i < num_intervals; ++i)
+    {
+      thrust::exclusive_scan(thrust::seq,
+                             first + decomp[i].begin(),
+                             first + decomp[i].end(),
+                             result + decomp[i].begin(),
+                             static_cast<ValueType>(carries[i]),
+                             binary_op);
+    }
+  }
+
+  return result + n;
+} // end exclusive_scan()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -14,6 +14,10 @@
  *  limitations under the License.
  */
 
+/*! \file scan_by_key.h
+ *  \brief OpenMP implementations of scan_by_key functions.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
@@ -25,7 +29,52 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/omp/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan_by_key(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       OutputIterator result,
+                                       BinaryPredicate binary_pred,
+                                       BinaryFunction binary_op);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename T,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan_by_key(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       OutputIterator result,
+                                       T init,
+                                       BinaryPredicate binary_pred,
+                                       BinaryFunction binary_op);
+
 
-// this system inherits this algorithm
-#include <thrust/system/cpp/detail/scan_by_key.h>
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
 
+#include <thrust/system/omp/detail/scan_by_key.inl>
@@ -0,0 +1,171 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file schedule.h
+ *  \brief How the OpenMP backend hands out the iterations of its parallel
+ *         loops.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+
+
+/*! \p schedule_kind names the OpenMP loop schedules which
+ *  <tt>thrust::omp::par.schedule(kind, chunk_size)</tt> can ask the loops of
+ *  \p for_each, \p transform, \p tabulate and \p reduce to use.
+ */
+enum schedule_kind
+{
+  /*! Iterations are divided among the threads up front. This is the default.
+   */
+  schedule_static,
+
+  /*! Chunks of iterations are handed to whichever thread is idle, which
+   *  balances loops whose iterations vary in cost.
+   */
+  schedule_dynamic,
+
+  /*! Like \p schedule_dynamic, but the chunks shrink as the loop drains.
+   */
+  schedule_guided
+};
+
+
+namespace detail
+{
+
+
+// a schedule kind with its chunk size; a chunk size of zero lets OpenMP pick
+struct loop_schedule
+{
+  schedule_kind kind;
+  int           chunk_size;
+
+  _CCCL_HOST_DEVICE
+  constexpr loop_schedule(schedule_kind kind = schedule_static, int chunk_size = 0)
+    : kind(kind), chunk_size(chunk_size)
+  {}
+};
+
+
+// fallback for policies which don't carry a schedule
+template<typename DerivedPolicy>
+loop_schedule get_schedule(execution_policy<DerivedPolicy> &)
+{
+  return loop_schedule();
+}
+
+
+// entry point
+template<typename DerivedPolicy>
+loop_schedule schedule_of(execution_policy<DerivedPolicy> &exec)
+{
+  return get_schedule(thrust::detail::derived_cast(exec));
+}
+
+
+// runs f(i) for every i in [0, n) on the threads of a parallel region,
+// handing out the iterations as sched asks
+template<typename Size, typename Function>
+void parallel_for(loop_schedule sched, Size n, Function f)
+{
+  const int chunk_size = sched.chunk_size > 0 ? sched.chunk_size : 1;
+
+  switch(sched.kind)
+  {
+    case schedule_dynamic:
+    {
+      THRUST_PRAGMA_OMP(parallel for schedule(dynamic, chunk_size))
+      for(Size i = 0; i < n; ++i)
+      {
+        f(i);
+      }
+      break;
+    }
+
+    case schedule_guided:
+    {
+      THRUST_PRAGMA_OMP(parallel for schedule(guided, chunk_size))
+      for(Size i = 0; i < n; ++i)
+      {
+        f(i);
+      }
+      break;
+    }
+
+    default:
+    {
+      if(sched.chunk_size > 0)
+      {
+        THRUST_PRAGMA_OMP(parallel for schedule(static, chunk_size))
+        for(Size i = 0; i < n; ++i)
+        {
+          f(i);
+        }
+      }
+      else
+      {
+        THRUST_PRAGMA_OMP(parallel for)
+        for(Size i = 0; i < n; ++i)
+        {
+          f(i);
+        }
+      }
+      break;
+    }
+  }
+}
+
+
+} // end detail
+
+
+} // end omp
+} // end system
+
+
+// alias schedule_kind and its enumerators here
+namespace omp
+{
+
+
+using thrust::system::omp::schedule_kind;
+using thrust::system::omp::schedule_static;
+using thrust::system::omp::schedule_dynamic;
+using thrust::system::omp::schedule_guided;
+
+
+} // end omp
+THRUST_NAMESPACE_END
+
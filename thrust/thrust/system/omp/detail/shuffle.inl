@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2008-2020 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#pragma once
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/omp/detail/shuffle.h>
+#include <thrust/system/omp/detail/num_threads.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/parallel_shuffle.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/shuffle.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename URBG>
+  void shuffle(execution_policy<DerivedPolicy> &exec,
+               RandomIterator first,
+               RandomIterator last,
+               URBG &&g)
+{
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<RandomIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<RandomIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  if(default_decomposition(n).size() <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::shuffle_algorithm, ValueType>(exec, n))
+  {
+    thrust::shuffle(thrust::seq, first, last, g);
+    return;
+  }
+
+  // the permutation gathers, so it can't be applied in place
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> temp(exec, first, last);
+
+  omp::detail::shuffle_copy(exec, temp.begin(), temp.end(), first, g);
+} // end shuffle()
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+  void shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &&g)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<RandomIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<RandomIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  const IndexType num_tiles = default_decomposition(n).size();
+
+  if(num_tiles <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::shuffle_algorithm, ValueType>(exec, n))
+  {
+    thrust::shuffle_copy(thrust::seq, first, last, result, g);
+    return;
+  }
+
+  thrust::system::detail::generic::feistel_bijection bijection(n, g);
+
+  thrust::system::detail::internal::parallel_shuffle_copy(exec, for_each_tile(), first, n, result, bijection, num_tiles);
+} // end shuffle_copy()
+
+
+} // end detail
+} // end omp
+} // end system
+THRUST_NAMESPACE_END
+
@@ -33,10 +33,19 @@
 
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/internal/parallel_radix_sort.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
+#include <thrust/system/omp/detail/num_threads.h>
 #include <thrust/sort.h>
 #include <thrust/merge.h>
+#include <thrust/copy.h>
+#include <thrust/extrema.h>
 #include <thrust/detail/seq.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/temporary_array.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -50,56 +59,125 @@ namespace sort_detail
 {
 
 
-template<typename DerivedPolicy,
-         typename RandomAccessIterator,
+// the offset of the first element of tile i, where tiles past the end are empty
+template<typename IndexType>
+IndexType tile_begin(const thrust::system::detail::internal::uniform_decomposition<IndexType> &tiles,
+                     IndexType n,
+                     IndexType i)
+{
+  return (i < tiles.size()) ? tiles[i].begin() : n;
+}
+
+
+// merge each pair of adjacent sorted runs of width tiles from src into dst
+// every thread of the team calls this and produces an equal share of the output
+// by cutting each merge along its merge path
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename IndexType,
          typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy> &exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+void merge_adjacent_runs(RandomAccessIterator1 src,
+                         RandomAccessIterator2 dst,
+                         const thrust::system::detail::internal::uniform_decomposition<IndexType> &tiles,
+                         IndexType n,
+                         IndexType width,
+                         IndexType thread_idx,
+                         IndexType num_threads,
+                         StrictWeakOrdering comp)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  thrust::system::detail::internal::uniform_decomposition<IndexType> shares(n, 1, num_threads);
+
+  if(thread_idx >= shares.size())
+    return;
+
+  const IndexType share_begin = shares[thread_idx].begin();
+  const IndexType share_end   = shares[thread_idx].end();
 
-  thrust::detail::temporary_array<value_type,DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type,DerivedPolicy> b(exec, middle, last);
+  for(IndexType run = 0; run < tiles.size(); run += 2 * width)
+  {
+    const IndexType begin1 = tile_begin(tiles, n, run);
+    const IndexType begin2 = tile_begin(tiles, n, run + width);
+    const IndexType end2   = tile_begin(tiles, n, run + 2 * width);
 
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+    // the part of this merge's output which belongs to this thread
+    const IndexType lo = thrust::max(begin1, share_begin) - begin1;
+    const IndexType hi = thrust::min(end2, share_end) - begin1;
+
+    if(lo >= hi)
+      continue;
+
+    const IndexType i0 = thrust::system::detail::internal::merge_path(src + begin1, begin2 - begin1, src + begin2, end2 - begin2, lo, comp);
+    const IndexType i1 = thrust::system::detail::internal::merge_path(src + begin1, begin2 - begin1, src + begin2, end2 - begin2, hi, comp);
+
+    thrust::merge(thrust::seq,
+                  src + begin1 + i0, src + begin1 + i1,
+                  src + begin2 + (lo - i0), src + begin2 + (hi - i1),
+                  dst + begin1 + lo,
+                  comp);
+  }
 }
 
 
-template<typename DerivedPolicy,
-         typename RandomAccessIterator1,
+template<typename RandomAccessIterator1,
          typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename IndexType,
          typename StrictWeakOrdering>
-void inplace_merge_by_key(execution_policy<DerivedPolicy> &exec,
-                          RandomAccessIterator1 first1,
-                          RandomAccessIterator1 middle1,
-                          RandomAccessIterator1 last1,
-                          RandomAccessIterator2 first2,
-                          StrictWeakOrdering comp)
+void merge_adjacent_runs_by_key(RandomAccessIterator1 keys_src,
+                                RandomAccessIterator2 values_src,
+                                RandomAccessIterator3 keys_dst,
+                                RandomAccessIterator4 values_dst,
+                                const thrust::system::detail::internal::uniform_decomposition<IndexType> &tiles,
+                                IndexType n,
+                                IndexType width,
+                                IndexType thread_idx,
+                                IndexType num_threads,
+                                StrictWeakOrdering comp)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type1;
-  typedef typename thrust::iterator_value<RandomAccessIterator2>::type value_type2;
-
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1   - first1);
-
-  thrust::detail::temporary_array<value_type1,DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1,DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2,DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2,DerivedPolicy> rhs2(exec, middle2, last2);
-
-  thrust::merge_by_key(thrust::seq,
-                       lhs1.begin(), lhs1.end(),
-                       rhs1.begin(), rhs1.end(),
-                       lhs2.begin(), rhs2.begin(),
-                       first1, first2,
-                       comp);
+  thrust::system::detail::internal::uniform_decomposition<IndexType> shares(n, 1, num_threads);
+
+  if(thread_idx >= shares.size())
+    return;
+
+  const IndexType share_begin = shares[thread_idx].begin();
+  const IndexType share_end   = shares[thread_idx].end();
+
+  for(IndexType run = 0; run < tiles.size(); run += 2 * width)
+  {
+    const IndexType begin1 = tile_begin(tiles, n, run);
+    const IndexType begin2 = tile_begin(tiles, n, run + width);
+    const IndexType end2   = tile_begin(tiles, n, run + 2 * width);
+
+    // the part of this merge's output which belongs to this thread
+    const IndexType lo = thrust::max(begin1, share_begin) - begin1;
+    const IndexType hi = thrust::min(end2, share_end) - begin1;
+
+    if(lo >= hi)
+      continue;
+
+    const IndexType i0 = thrust::system::detail::internal::merge_path(keys_src + begin1, begin2 - begin1, keys_src + begin2, end2 - begin2, lo, comp);
+    const IndexType i1 = thrust::system::detail::internal::merge_path(keys_src + begin1, begin2 - begin1, keys_src + begin2, end2 - begin2, hi, comp);
+
+    thrust::merge_by_key(thrust::seq,
+                         keys_src + begin1 + i0, keys_src + begin1 + i1,
+                         keys_src + begin2 + (lo - i0), keys_src + begin2 + (hi - i1),
+                         values_src + begin1 + i0,
+                         values_src + begin2 + (lo - i0),
+                         keys_dst + begin1 + lo,
+                         values_dst + begin1 + lo,
+                         comp);
+  }
 }
 
 
-} // end sort_detail
+// each pass of the radix sort reads a private histogram per tile, so a tile
+// needs to hold a good multiple of the number of buckets to pay for it
+template<typename IndexType>
+bool radix_sort_pays_off(IndexType n, IndexType num_tiles)
+{
+  return num_tiles > 1 && n >= num_tiles * IndexType(4 * thrust::system::detail::internal::radix_sort_detail::num_buckets);
+}
 
 
 template<typename DerivedPolicy,
@@ -108,40 +186,42 @@ template<typename DerivedPolicy,
 void stable_sort(execution_policy<DerivedPolicy> &exec,
                  RandomAccessIterator first,
                  RandomAccessIterator last,
-                 StrictWeakOrdering comp)
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type) // use merge sort
 {
-  // we're attempting to launch an omp kernel, assert we're compiling with omp support
-  // ========================================================================
-  // X Note to the user: If you've found this line due to a compiler error, X
-  // X you need to enable OpenMP support in your compiler.                  X
-  // ========================================================================
-  THRUST_STATIC_ASSERT_MSG(
-    (thrust::detail::depend_on_instantiation<
-      RandomAccessIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-    >::value)
-  , "OpenMP compiler support is not enabled"
-  );
-
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      value_type;
 
   if(first == last)
     return;
 
+  if(omp_get_max_threads() == 1)
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  const IndexType n = last - first;
+
+  // the merge phase ping-pongs between the input and this buffer
+  thrust::detail::temporary_array<value_type,DerivedPolicy> temp(exec, n);
+  value_type *temp_ptr = thrust::raw_pointer_cast(temp.data());
+
   THRUST_PRAGMA_OMP(parallel)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
+    const IndexType num_threads = omp_get_num_threads();
+    const IndexType thread_idx  = omp_get_thread_num();
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
+    thrust::system::detail::internal::uniform_decomposition<IndexType> tiles(n, 1, num_threads);
 
     // every thread sorts its own tile
-    if(p_i < decomp.size())
+    if(thread_idx < tiles.size())
     {
       thrust::stable_sort(thrust::seq,
-                          first + decomp[p_i].begin(),
-                          first + decomp[p_i].end(),
+                          first + tiles[thread_idx].begin(),
+                          first + tiles[thread_idx].end(),
                           comp);
     }
 
@@ -150,39 +230,64 @@ void stable_sort(execution_policy<DerivedPolicy> &exec,
     // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
     ;
 
-    IndexType nseg = decomp.size();
-    IndexType h = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a=p_i, b=p_i, c=p_i+1;
+    // merge pairs of runs until a single run remains, with all threads working on every level
+    bool sorted_into_temp = false;
 
-    while(nseg>1)
+    for(IndexType width = 1; width < tiles.size(); width *= 2)
     {
-      if(c >= decomp.size())
-        c = decomp.size() - 1;
-
-      if((p_i % h) == 0 && c > b)
+      if(sorted_into_temp)
       {
-        sort_detail::inplace_merge(exec,
-                                   first + decomp[a].begin(),
-                                   first + decomp[b].end(),
-                                   first + decomp[c].end(),
-                                   comp);
-
-        b = c;
-        c += h;
+        sort_detail::merge_adjacent_runs(temp_ptr, first, tiles, n, width, thread_idx, num_threads, comp);
+      }
+      else
+      {
+        sort_detail::merge_adjacent_runs(first, temp_ptr, tiles, n, width, thread_idx, num_threads, comp);
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      sorted_into_temp = !sorted_into_temp;
 
       THRUST_PRAGMA_OMP(barrier)
     }
+
+    // an odd number of levels leaves the result in the buffer
+    if(sorted_into_temp && thread_idx < tiles.size())
+    {
+      thrust::copy(thrust::seq,
+                   temp_ptr + tiles[thread_idx].begin(),
+                   temp_ptr + tiles[thread_idx].end(),
+                   first + tiles[thread_idx].begin());
+    }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
 
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type) // use radix sort
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = default_decomposition(n);
+
+  if(!radix_sort_pays_off(n, decomp.size()))
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  thrust::system::detail::internal::parallel_radix_sort<false>
+    (exec, for_each_tile(), first, static_cast<int*>(0), n, decomp.size(), comp);
+}
+
+
 template<typename DerivedPolicy,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
@@ -191,41 +296,46 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
                         RandomAccessIterator1 keys_first,
                         RandomAccessIterator1 keys_last,
                         RandomAccessIterator2 values_first,
-                        StrictWeakOrdering comp)
+                        StrictWeakOrdering comp,
+                        thrust::detail::false_type) // use merge sort
 {
-  // we're attempting to launch an omp kernel, assert we're compiling with omp support
-  // ========================================================================
-  // X Note to the user: If you've found this line due to a compiler error, X
-  // X you need to enable OpenMP support in your compiler.                  X
-  // ========================================================================
-  THRUST_STATIC_ASSERT_MSG(
-    (thrust::detail::depend_on_instantiation<
-      RandomAccessIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-    >::value)
-  , "OpenMP compiler support is not enabled"
-  );
-
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   typedef typename thrust::iterator_difference<RandomAccessIterator1>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      key_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      value_type;
 
   if(keys_first == keys_last)
     return;
 
+  if(omp_get_max_threads() == 1)
+  {
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  const IndexType n = keys_last - keys_first;
+
+  // the merge phase ping-pongs between the input and these buffers
+  thrust::detail::temporary_array<key_type,DerivedPolicy>   keys_temp(exec, n);
+  thrust::detail::temporary_array<value_type,DerivedPolicy> values_temp(exec, n);
+  key_type   *keys_temp_ptr   = thrust::raw_pointer_cast(keys_temp.data());
+  value_type *values_temp_ptr = thrust::raw_pointer_cast(values_temp.data());
+
   THRUST_PRAGMA_OMP(parallel)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(keys_last - keys_first, 1, omp_get_num_threads());
+    const IndexType num_threads = omp_get_num_threads();
+    const IndexType thread_idx  = omp_get_thread_num();
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
+    thrust::system::detail::internal::uniform_decomposition<IndexType> tiles(n, 1, num_threads);
 
     // every thread sorts its own tile
-    if(p_i < decomp.size())
+    if(thread_idx < tiles.size())
     {
       thrust::stable_sort_by_key(thrust::seq,
-                                 keys_first + decomp[p_i].begin(),
-                                 keys_first + decomp[p_i].end(),
-                                 values_first + decomp[p_i].begin(),
+                                 keys_first + tiles[thread_idx].begin(),
+                                 keys_first + tiles[thread_idx].end(),
+                                 values_first + tiles[thread_idx].begin(),
                                  comp);
     }
 
@@ -234,40 +344,145 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
     // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
     ;
 
-    IndexType nseg = decomp.size();
-    IndexType h = 2;
+    // merge pairs of runs until a single run remains, with all threads working on every level
+    bool sorted_into_temp = false;
 
-    // keep track of which sub-range we're processing
-    IndexType a=p_i, b=p_i, c=p_i+1;
-
-    while(nseg>1)
+    for(IndexType width = 1; width < tiles.size(); width *= 2)
     {
-      if(c >= decomp.size())
-        c = decomp.size() - 1;
-
-      if((p_i % h) == 0 && c > b)
+      if(sorted_into_temp)
+      {
+        sort_detail::merge_adjacent_runs_by_key(keys_temp_ptr, values_temp_ptr, keys_first, values_first, tiles, n, width, thread_idx, num_threads, comp);
+      }
+      else
       {
-        sort_detail::inplace_merge_by_key(exec,
-                                          keys_first + decomp[a].begin(),
-                                          keys_first + decomp[b].end(),
-                                          keys_first + decomp[c].end(),
-                                          values_first + decomp[a].begin(),
-                                          comp);
-
-        b = c;
-        c += h;
+        sort_detail::merge_adjacent_runs_by_key(keys_first, values_first, keys_temp_ptr, values_temp_ptr, tiles, n, width, thread_idx, num_threads, comp);
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      sorted_into_temp = !sorted_into_temp;
 
       THRUST_PRAGMA_OMP(barrier)
     }
+
+    // an odd number of levels leaves the result in the buffers
+    if(sorted_into_temp && thread_idx < tiles.size())
+    {
+      thrust::copy(thrust::seq,
+                   keys_temp_ptr + tiles[thread_idx].begin(),
+                   keys_temp_ptr + tiles[thread_idx].end(),
+                   keys_first + tiles[thread_idx].begin());
+
+      thrust::copy(thrust::seq,
+                   values_temp_ptr + tiles[thread_idx].begin(),
+                   values_temp_ptr + tiles[thread_idx].end(),
+                   values_first + tiles[thread_idx].begin());
+    }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
 
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1 keys_last,
+                        RandomAccessIterator2 values_first,
+                        StrictWeakOrdering comp,
+                        thrust::detail::true_type) // use radix sort
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type IndexType;
+
+  const IndexType n = keys_last - keys_first;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = default_decomposition(n);
+
+  if(!radix_sort_pays_off(n, decomp.size()))
+  {
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  thrust::system::detail::internal::parallel_radix_sort<true>
+    (exec, for_each_tile(), keys_first, values_first, n, decomp.size(), comp);
+}
+
+
+} // end sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  if(thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::sort_algorithm, value_type>(exec, thrust::distance(first, last)))
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  sort_detail::stable_sort(exec, first, last, comp,
+    thrust::system::detail::internal::use_parallel_radix_sort<value_type,StrictWeakOrdering>());
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1 keys_last,
+                        RandomAccessIterator2 values_first,
+                        StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type key_type;
+
+  if(thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::sort_algorithm, key_type>(exec, thrust::distance(keys_first, keys_last)))
+  {
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  sort_detail::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp,
+    thrust::system::detail::internal::use_parallel_radix_sort<key_type,StrictWeakOrdering>());
+}
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -0,0 +1,203 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/omp/detail/stream_compaction.h>
+#include <thrust/system/omp/detail/num_threads.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace stream_compaction_detail
+{
+
+
+template<typename InputIterator,
+         typename OutputIterator>
+  void copy_and_advance(InputIterator input, OutputIterator &output)
+{
+  *output = *input;
+  ++output;
+}
+
+
+// discarded elements don't even need to be read
+template<typename InputIterator,
+         typename System>
+  void copy_and_advance(InputIterator, thrust::discard_iterator<System> &output)
+{
+  ++output;
+}
+
+
+} // end stream_compaction_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename Predicate>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    stream_compaction(execution_policy<DerivedPolicy> &exec,
+                      InputIterator1 first,
+                      InputIterator1 last,
+                      InputIterator2 stencil,
+                      OutputIterator1 out_true,
+                      OutputIterator2 out_false,
+                      Predicate pred)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  num_threads_guard guard(exec);
+
+  typedef typename thrust::iterator_value<InputIterator1>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator1>::type difference_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  // a single interval has no parallelism to exploit, and a short input isn't
+  // worth a parallel region, so compact in a single sweep
+  if(decomp.size() <= 1 || thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::copy_if_algorithm, value_type>(exec, n))
+  {
+    OutputIterator1 true_result  = out_true;
+    OutputIterator2 false_result = out_false;
+
+    for(difference_type i = 0; i < n; ++i)
+    {
+      if(wrapped_pred(*(stencil + i)))
+      {
+        stream_compaction_detail::copy_and_advance(first + i, true_result);
+      }
+      else
+      {
+        stream_compaction_detail::copy_and_advance(first + i, false_result);
+      }
+    }
+
+    return thrust::make_pair(true_result, false_result);
+  }
+
+  const difference_type num_intervals = decomp.size();
+
+  // the outcome of each evaluation of pred
+  thrust::detail::temporary_array<bool,DerivedPolicy> flags(0, exec, n);
+  bool *raw_flags = thrust::raw_pointer_cast(flags.data());
+
+  // offsets[i] is the number of true elements preceding interval i
+  thrust::detail::temporary_array<difference_type,DerivedPolicy> offsets(exec, num_intervals + 1);
+  difference_type *raw_offsets = thrust::raw_pointer_cast(offsets.data());
+
+  raw_offsets[0] = 0;
+
+  THRUST_PRAGMA_OMP(parallel)
+  {
+    // first pass: evaluate pred and count the true elements of each interval
+    THRUST_PRAGMA_OMP(for)
+    for(difference_type i = 0; i < num_intervals; ++i)
+    {
+      difference_type count = 0;
+
+      for(difference_type j = decomp[i].begin(); j < decomp[i].end(); ++j)
+      {
+        const bool flag = wrapped_pred(*(stencil + j));
+        raw_flags[j] = flag;
+        count += flag;
+      }
+
+      raw_offsets[i + 1] = count;
+    }
+
+    // scan the counts to find where each interval's output begins
+    THRUST_PRAGMA_OMP(single)
+    {
+      for(difference_type i = 0; i < num_intervals; ++i)
+      {
+        raw_offsets[i + 1] += raw_offsets[i];
+      }
+    }
+
+    // second pass: write each element directly to its final position
+    THRUST_PRAGMA_OMP(for)
+    for(difference_type i = 0; i < num_intervals; ++i)
+    {
+      OutputIterator1 true_result  = out_true  + raw_offsets[i];
+      OutputIterator2 false_result = out_false + (decomp[i].begin() - raw_offsets[i]);
+
+      for(difference_type j = decomp[i].begin(); j < decomp[i].end(); ++j)
+      {
+        if(raw_flags[j])
+        {
+          stream_compaction_detail::copy_and_advance(first + j, true_result);
+        }
+        else
+        {
+          stream_compaction_detail::copy_and_advance(first + j, false_result);
+        }
+      }
+    }
+  }
+
+  const difference_type num_true = raw_offsets[num_intervals];
+
+  return thrust::make_pair(out_true + num_true, out_false + (n - num_true));
+} // end stream_compaction()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -147,6 +147,27 @@ struct tag : thrust::system::omp::execution_policy<tag> { unspecified };
  *
  *  // 0 1 2 is printed to standard output in some unspecified order
  *  \endcode
+ *
+ *  When the cost of the work done per element varies, <tt>par.schedule(kind, chunk_size)</tt>
+ *  returns a policy whose \p for_each, \p transform, \p tabulate and \p reduce hand out their
+ *  iterations with the OpenMP loop schedule \p kind, one of \p thrust::omp::schedule_static,
+ *  \p thrust::omp::schedule_dynamic or \p thrust::omp::schedule_guided. A \p chunk_size of zero
+ *  lets OpenMP pick:
+ *
+ *  \code
+ *  thrust::for_each(thrust::omp::par.schedule(thrust::omp::schedule_dynamic, 64),
+ *                   rays.begin(), rays.end(), march_functor());
+ *  \endcode
+ *
+ *  <tt>par.on(num_threads)</tt> returns a policy whose algorithms run their parallel regions on
+ *  \p num_threads threads. Which processors those threads are bound to is left to the OpenMP
+ *  runtime, e.g. through \p OMP_PLACES and \p OMP_PROC_BIND. The two can be combined, as in
+ *  <tt>par.on(4).schedule(thrust::omp::schedule_guided)</tt>.
+ *
+ *  An algorithm given fewer elements than it is worth opening a parallel region for runs
+ *  sequentially on the calling thread instead. The cutoff depends on the algorithm and the type
+ *  of its elements; <tt>par.min_parallel_size(n)</tt> returns a policy whose algorithms use the
+ *  cutoff \p n instead, and <tt>par.min_parallel_size(1)</tt> parallelizes whatever it can.
  */
 static const unspecified par;
 
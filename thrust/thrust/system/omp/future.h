@@ -0,0 +1,70 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file omp/future.h
+ *  \brief The events and futures of the asynchronous algorithms of the
+ *         OpenMP system, which are those of the Standard C++ system.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#include <thrust/system/cpp/future.h>
+#include <thrust/system/omp/pointer.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system { namespace omp
+{
+
+using thrust::system::cpp::unique_eager_event;
+
+using thrust::system::cpp::unique_eager_future;
+
+using thrust::system::cpp::when_all;
+
+}} // namespace system::omp
+
+namespace omp
+{
+
+using thrust::system::omp::unique_eager_event;
+using event = unique_eager_event;
+
+using thrust::system::omp::unique_eager_future;
+template <typename T> using future = unique_eager_future<T>;
+
+using thrust::system::omp::when_all;
+
+} // namespace omp
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
+
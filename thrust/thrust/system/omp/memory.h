@@ -90,6 +90,15 @@ using universal_allocator = thrust::mr::stateless_resource_allocator<
   T, thrust::system::omp::universal_memory_resource
 >;
 
+/*! \p omp::interleaved_allocator allocates memory for the \p omp system whose
+ *  pages are spread over the NUMA nodes of the host, e.g. for an
+ *  <tt>omp::vector</tt> which every thread reads.
+ */
+template<typename T>
+using interleaved_allocator = thrust::mr::stateless_resource_allocator<
+  T, thrust::system::omp::interleaved_memory_resource
+>;
+
 }} // namespace system::omp
 
 /*! \namespace thrust::omp
@@ -101,6 +110,7 @@ using thrust::system::omp::malloc;
 using thrust::system::omp::free;
 using thrust::system::omp::allocator;
 using thrust::system::omp::universal_allocator;
+using thrust::system::omp::interleaved_allocator;
 } // namespace omp
 
 THRUST_NAMESPACE_END
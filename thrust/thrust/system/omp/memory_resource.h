@@ -29,10 +29,10 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/mr/new.h>
 #include <thrust/mr/fancy_pointer_resource.h>
 
 #include <thrust/system/omp/pointer.h>
+#include <thrust/system/omp/detail/numa_resource.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system { namespace omp
@@ -42,14 +42,19 @@ namespace system { namespace omp
 namespace detail
 {
     typedef thrust::mr::fancy_pointer_resource<
-        thrust::mr::new_delete_resource,
+        numa_resource<numa_first_touch>,
         thrust::omp::pointer<void>
     > native_resource;
 
     typedef thrust::mr::fancy_pointer_resource<
-        thrust::mr::new_delete_resource,
+        numa_resource<numa_first_touch>,
         thrust::omp::universal_pointer<void>
     > universal_native_resource;
+
+    typedef thrust::mr::fancy_pointer_resource<
+        numa_resource<numa_interleaved>,
+        thrust::omp::pointer<void>
+    > interleaved_native_resource;
 } // namespace detail
 //! \endcond
 
@@ -58,14 +63,21 @@ namespace detail
  *  \{
  */
 
-/*! The memory resource for the OpenMP system. Uses \p mr::new_delete_resource
- *  and tags it with \p omp::pointer.
+/*! The memory resource for the OpenMP system. Maps large allocations to fresh
+ *  pages, which land on the NUMA node of the thread that first touches them,
+ *  uses \p mr::new_delete_resource for the others, and tags them with
+ *  \p omp::pointer.
  */
 typedef detail::native_resource memory_resource;
-/*! The unified memory resource for the OpenMP system. Uses
- *  \p mr::new_delete_resource and tags it with \p omp::universal_pointer.
+/*! The unified memory resource for the OpenMP system. Allocates like
+ *  \p omp::memory_resource and tags it with \p omp::universal_pointer.
  */
 typedef detail::universal_native_resource universal_memory_resource;
+/*! A memory resource for the OpenMP system which interleaves the pages of
+ *  large allocations over the NUMA nodes the process may use, for data which
+ *  every thread reads. Tags it with \p omp::pointer.
+ */
+typedef detail::interleaved_native_resource interleaved_memory_resource;
 /*! An alias for \p omp::universal_memory_resource. */
 typedef detail::native_resource universal_host_pinned_memory_resource;
 
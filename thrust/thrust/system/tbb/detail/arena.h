@@ -0,0 +1,95 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file arena.h
+ *  \brief The task arena the TBB backend's algorithms run in.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+
+// fallback for policies which aren't bound to an arena; their algorithms run
+// in the arena of the calling thread
+template<typename DerivedPolicy>
+::tbb::task_arena *get_arena(execution_policy<DerivedPolicy> &)
+{
+  return 0;
+}
+
+
+// entry point
+template<typename DerivedPolicy>
+::tbb::task_arena *arena_of(execution_policy<DerivedPolicy> &exec)
+{
+  return get_arena(thrust::detail::derived_cast(exec));
+}
+
+
+// runs f() in arena, or right here when arena is null
+template<typename Function>
+void execute_in(::tbb::task_arena *arena, Function f)
+{
+  if(arena)
+  {
+    arena->execute(f);
+  }
+  else
+  {
+    f();
+  }
+}
+
+
+// the number of threads which can work on an algorithm run in arena, or in
+// the calling thread's arena when arena is null
+inline unsigned int max_concurrency(::tbb::task_arena *arena)
+{
+  if(arena)
+  {
+    return thrust::max<unsigned int>(1u, arena->max_concurrency());
+  }
+
+  return thrust::max<unsigned int>(1u, ::tbb::this_task_arena::max_concurrency());
+}
+
+
+} // end detail
+} // end tbb
+} // end system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,69 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file launch.h
+ *  \brief Runs the asynchronous algorithms of the TBB system in a task arena.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#include <thrust/system/cpp/detail/async/launch.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <tbb/task_arena.h>
+
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace system { namespace tbb { namespace detail
+{
+
+// Enqueues job as a task of the arena exec is bound to, or else of the
+// calling thread's, so it's run by that arena's workers rather than by the
+// threads of the Standard C++ system.
+template<typename DerivedPolicy, typename Job>
+void enqueue_async(execution_policy<DerivedPolicy> &exec, Job job)
+{
+  if(::tbb::task_arena *arena = arena_of(exec))
+  {
+    arena->enqueue(std::move(job));
+  }
+  else
+  {
+    ::tbb::this_task_arena::enqueue(std::move(job));
+  }
+}
+
+}}} // namespace system::tbb::detail
+
+THRUST_NAMESPACE_END
+
+#endif // C++14
+
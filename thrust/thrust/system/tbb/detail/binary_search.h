@@ -14,6 +14,7 @@
  *  limitations under the License.
  */
 
+
 #pragma once
 
 #include <thrust/detail/config.h>
@@ -25,7 +26,120 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/parallel_binary_search.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/binary_search.h>
+#include <thrust/detail/seq.h>
 
-// this system inherits binary_search
+// this system inherits the scalar binary search algorithms
 #include <thrust/system/cpp/detail/binary_search.h>
 
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator lower_bound(execution_policy<DerivedPolicy> &exec,
+                           ForwardIterator begin,
+                           ForwardIterator end,
+                           InputIterator values_begin,
+                           InputIterator values_end,
+                           OutputIterator output,
+                           StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type m = values_end - values_begin;
+
+  const difference_type tiles = num_tiles_for<thrust::system::detail::internal::binary_search_algorithm, value_type>(exec, m);
+
+  if(tiles <= 1)
+  {
+    // don't bother parallelizing for small m
+    return thrust::lower_bound(thrust::seq, begin, end, values_begin, values_end, output, comp);
+  }
+
+  return thrust::system::detail::internal::parallel_binary_search<thrust::system::detail::internal::binary_search_detail::lower_bound_search>
+    (for_each_tile(exec), begin, difference_type(end - begin), values_begin, m, output, tiles, comp);
+} // end lower_bound()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator upper_bound(execution_policy<DerivedPolicy> &exec,
+                           ForwardIterator begin,
+                           ForwardIterator end,
+                           InputIterator values_begin,
+                           InputIterator values_end,
+                           OutputIterator output,
+                           StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type m = values_end - values_begin;
+
+  const difference_type tiles = num_tiles_for<thrust::system::detail::internal::binary_search_algorithm, value_type>(exec, m);
+
+  if(tiles <= 1)
+  {
+    // don't bother parallelizing for small m
+    return thrust::upper_bound(thrust::seq, begin, end, values_begin, values_end, output, comp);
+  }
+
+  return thrust::system::detail::internal::parallel_binary_search<thrust::system::detail::internal::binary_search_detail::upper_bound_search>
+    (for_each_tile(exec), begin, difference_type(end - begin), values_begin, m, output, tiles, comp);
+} // end upper_bound()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator binary_search(execution_policy<DerivedPolicy> &exec,
+                             ForwardIterator begin,
+                             ForwardIterator end,
+                             InputIterator values_begin,
+                             InputIterator values_end,
+                             OutputIterator output,
+                             StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type m = values_end - values_begin;
+
+  const difference_type tiles = num_tiles_for<thrust::system::detail::internal::binary_search_algorithm, value_type>(exec, m);
+
+  if(tiles <= 1)
+  {
+    // don't bother parallelizing for small m
+    return thrust::binary_search(thrust::seq, begin, end, values_begin, values_end, output, comp);
+  }
+
+  return thrust::system::detail::internal::parallel_binary_search<thrust::system::detail::internal::binary_search_detail::binary_search_search>
+    (for_each_tile(exec), begin, difference_type(end - begin), values_begin, m, output, tiles, comp);
+} // end binary_search()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
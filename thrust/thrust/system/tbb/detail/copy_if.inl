@@ -29,6 +29,10 @@
 #include <thrust/system/tbb/detail/copy_if.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/copy.h>
+#include <thrust/detail/seq.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_scan.h>
 
@@ -105,26 +109,36 @@ struct body
 
 } // end copy_if_detail
 
-template<typename InputIterator1,
+template<typename DerivedPolicy,
+         typename InputIterator1,
          typename InputIterator2,
          typename OutputIterator,
          typename Predicate>
-  OutputIterator copy_if(tag,
+  OutputIterator copy_if(execution_policy<DerivedPolicy> &exec,
                          InputIterator1 first,
                          InputIterator1 last,
                          InputIterator2 stencil,
                          OutputIterator result,
                          Predicate pred)
 {
+  typedef typename thrust::iterator_value<InputIterator1>::type      ValueType;
   typedef typename thrust::iterator_difference<InputIterator1>::type Size;
   typedef typename copy_if_detail::body<InputIterator1,InputIterator2,OutputIterator,Predicate,Size> Body;
 
   Size n = thrust::distance(first, last);
 
-  if (n != 0)
+  if (thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::copy_if_algorithm, ValueType>(exec, n))
+  {
+    // don't bother parallelizing for small n
+    return thrust::copy_if(thrust::seq, first, last, stencil, result, pred);
+  }
+  else
   {
     Body body(first, stencil, result, pred);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0,n), body);
+    execute_in(arena_of(exec), [&]
+    {
+      ::tbb::parallel_scan(::tbb::blocked_range<Size>(0,n), body);
+    });
     thrust::advance(result, body.sum);
   }
 
@@ -25,8 +25,12 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/find.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/parallel_find_if.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/find.h>
+#include <thrust/detail/seq.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -35,15 +39,27 @@ namespace tbb
 {
 namespace detail
 {
-
 template <typename DerivedPolicy, typename InputIterator, typename Predicate>
 InputIterator find_if(execution_policy<DerivedPolicy> &exec,
                       InputIterator first,
                       InputIterator last,
                       Predicate pred)
 {
-  // tbb prefers generic::find_if to cpp::find_if
-  return thrust::system::detail::generic::find_if(exec, first, last, pred);
+  typedef typename thrust::iterator_value<InputIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type n = last - first;
+
+  const difference_type num_workers = num_tiles_for<thrust::system::detail::internal::find_algorithm, value_type>(exec, n);
+
+  if(num_workers <= 1)
+  {
+    // don't bother parallelizing for small n
+    return thrust::find_if(thrust::seq, first, last, pred);
+  }
+
+  // the workers stop claiming input once one of them finds a match before it
+  return thrust::system::detail::internal::parallel_find_if(for_each_tile(exec), first, n, num_workers, pred);
 }
 
 } // end namespace detail
@@ -30,6 +30,8 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
@@ -79,12 +81,23 @@ template<typename DerivedPolicy,
          typename RandomAccessIterator,
          typename Size,
          typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy> &,
+RandomAccessIterator for_each_n(execution_policy<DerivedPolicy> &exec,
                                 RandomAccessIterator first,
                                 Size n,
                                 UnaryFunction f)
 {
-  ::tbb::parallel_for(::tbb::blocked_range<Size>(0,n), for_each_detail::make_body<Size>(first,f));
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  if (thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::for_each_algorithm, value_type>(exec, n))
+  {
+    // don't bother parallelizing for small n
+    return thrust::for_each_n(thrust::system::detail::sequential::seq, first, n, f);
+  }
+
+  execute_in(arena_of(exec), [&]
+  {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0,n), for_each_detail::make_body<Size>(first,f));
+  });
 
   // return the end of the range
   return first + n;
@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace for_each_tile_detail
+{
+
+
+template<typename Function>
+struct body
+{
+  Function f;
+
+  body(Function f)
+    : f(f)
+  {}
+
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size tile = r.begin(); tile != r.end(); ++tile)
+    {
+      f(tile);
+    }
+  }
+};
+
+
+} // end namespace for_each_tile_detail
+
+
+// runs f(tile) for every tile as its own task, in the arena of the policy
+// it was made from; this is the for_each_tile callable expected by the tiled
+// engines in thrust/system/detail/internal
+struct for_each_tile
+{
+  ::tbb::task_arena *arena;
+
+  template<typename DerivedPolicy>
+  explicit for_each_tile(execution_policy<DerivedPolicy> &exec)
+    : arena(arena_of(exec))
+  {}
+
+  template<typename Size, typename Function>
+  void operator()(Size num_tiles, Function f) const
+  {
+    execute_in(arena, [&]
+    {
+      // force grainsize == 1 with simple_partioner()
+      ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1),
+                          for_each_tile_detail::body<Function>(f),
+                          ::tbb::simple_partitioner());
+    });
+  }
+};
+
+
+// the number of tiles to split n elements into, one per thread of exec's
+// arena but none smaller than min_tile_size
+template<typename DerivedPolicy, typename Size>
+Size num_tiles(execution_policy<DerivedPolicy> &exec, Size n, Size min_tile_size)
+{
+  const unsigned int p = max_concurrency(arena_of(exec));
+
+  // XXX oversubscribing is a tuning opportunity
+  return thrust::max<Size>(1, thrust::min<Size>(p, n / min_tile_size));
+}
+
+
+// the number of tiles to split n elements of type T into for Algorithm: one
+// below exec's min_parallel_size for it, otherwise one per thread of exec's
+// arena but none smaller than half that size
+template<typename Algorithm, typename T, typename DerivedPolicy, typename Size>
+Size num_tiles_for(execution_policy<DerivedPolicy> &exec, Size n)
+{
+  if(thrust::system::detail::internal::below_min_parallel_size<Algorithm,T>(exec, n))
+  {
+    return 1;
+  }
+
+  const Size min_size = static_cast<Size>(thrust::system::detail::internal::min_parallel_size_of<Algorithm,T>(exec));
+
+  return num_tiles(exec, n, thrust::max<Size>(1, min_size / 2));
+}
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -32,6 +32,8 @@
 #include <thrust/merge.h>
 #include <thrust/binary_search.h>
 #include <thrust/detail/seq.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
 #include <tbb/parallel_for.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -236,7 +238,7 @@ template<typename DerivedPolicy,
          typename InputIterator2,
          typename OutputIterator,
          typename StrictWeakOrdering>
-OutputIterator merge(execution_policy<DerivedPolicy> &,
+OutputIterator merge(execution_policy<DerivedPolicy> &exec,
                      InputIterator1 first1,
                      InputIterator1 last1,
                      InputIterator2 first2,
@@ -244,12 +246,23 @@ OutputIterator merge(execution_policy<DerivedPolicy> &,
                      OutputIterator result,
                      StrictWeakOrdering comp)
 {
+  typedef typename thrust::iterator_value<InputIterator1>::type value_type;
+
+  if(thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::merge_algorithm, value_type>(exec, thrust::distance(first1, last1) + thrust::distance(first2, last2)))
+  {
+    // don't bother parallelizing for small n
+    return thrust::merge(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+
   typedef typename merge_detail::range<InputIterator1,InputIterator2,OutputIterator,StrictWeakOrdering> Range;
   typedef          merge_detail::body                                                                   Body;
   Range range(first1, last1, first2, last2, result, comp);
   Body  body;
 
-  ::tbb::parallel_for(range, body);
+  execute_in(arena_of(exec), [&]
+  {
+    ::tbb::parallel_for(range, body);
+  });
 
   thrust::advance(result, thrust::distance(first1, last1) + thrust::distance(first2, last2));
 
@@ -265,7 +278,7 @@ template <typename DerivedPolicy,
           typename OutputIterator2,
           typename StrictWeakOrdering>
 thrust::pair<OutputIterator1,OutputIterator2>
-  merge_by_key(execution_policy<DerivedPolicy> &,
+  merge_by_key(execution_policy<DerivedPolicy> &exec,
                InputIterator1 keys_first1,
                InputIterator1 keys_last1,
                InputIterator2 keys_first2,
@@ -276,13 +289,24 @@ thrust::pair<OutputIterator1,OutputIterator2>
                OutputIterator2 values_result,
                StrictWeakOrdering comp)
 {
+  typedef typename thrust::iterator_value<InputIterator1>::type key_type;
+
+  if(thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::merge_algorithm, key_type>(exec, thrust::distance(keys_first1, keys_last1) + thrust::distance(keys_first2, keys_last2)))
+  {
+    // don't bother parallelizing for small n
+    return thrust::merge_by_key(thrust::seq, keys_first1, keys_last1, keys_first2, keys_last2, values_first3, values_first4, keys_result, values_result, comp);
+  }
+
   typedef typename merge_by_key_detail::range<InputIterator1,InputIterator2,InputIterator3,InputIterator4,OutputIterator1,OutputIterator2,StrictWeakOrdering> Range;
   typedef          merge_by_key_detail::body                                                                                                                  Body;
 
   Range range(keys_first1, keys_last1, keys_first2, keys_last2, values_first3, values_first4, keys_result, values_result, comp);
   Body  body;
 
-  ::tbb::parallel_for(range, body);
+  execute_in(arena_of(exec), [&]
+  {
+    ::tbb::parallel_for(range, body);
+  });
 
   thrust::advance(keys_result,   thrust::distance(keys_first1, keys_last1) + thrust::distance(keys_first2, keys_last2));
   thrust::advance(values_result, thrust::distance(keys_first1, keys_last1) + thrust::distance(keys_first2, keys_last2));
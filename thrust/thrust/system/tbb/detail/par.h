@@ -26,7 +26,14 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#if _CCCL_STD_VER >= 2011
+#  include <thrust/detail/dependencies_aware_execution_policy.h>
+#endif
+#include <thrust/system/tbb/detail/arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+
+#include <cstddef>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -37,12 +44,80 @@ namespace detail
 {
 
 
+// a tbb policy whose algorithms run in a given task arena, and sequentially
+// below a given input size
+template<typename Derived>
+struct execute_on_arena_base : thrust::system::tbb::detail::execution_policy<Derived>
+{
+private:
+  ::tbb::task_arena *arena;
+  std::size_t        min_size;
+
+public:
+  _CCCL_HOST_DEVICE
+  constexpr execute_on_arena_base(::tbb::task_arena *arena_ = 0, std::size_t min_size_ = 0)
+    : arena(arena_), min_size(min_size_)
+  {}
+
+  Derived on(::tbb::task_arena &a) const
+  {
+    Derived result = thrust::detail::derived_cast(*this);
+    result.arena   = &a;
+    return result;
+  }
+
+  Derived min_parallel_size(std::size_t n) const
+  {
+    Derived result  = thrust::detail::derived_cast(*this);
+    result.min_size = n;
+    return result;
+  }
+
+private:
+  friend ::tbb::task_arena *get_arena(const execute_on_arena_base &exec)
+  {
+    return exec.arena;
+  }
+
+  friend std::size_t get_min_parallel_size(const execute_on_arena_base &exec)
+  {
+    return exec.min_size;
+  }
+};
+
+
+struct execute_on_arena : execute_on_arena_base<execute_on_arena>
+{
+  typedef execute_on_arena_base<execute_on_arena> base_t;
+
+  _CCCL_HOST_DEVICE
+  constexpr execute_on_arena() : base_t() {}
+
+  _CCCL_HOST_DEVICE
+  constexpr execute_on_arena(::tbb::task_arena *arena, std::size_t min_size = 0) : base_t(arena, min_size) {}
+};
+
+
 struct par_t : thrust::system::tbb::detail::execution_policy<par_t>,
   thrust::detail::allocator_aware_execution_policy<
-    thrust::system::tbb::detail::execution_policy>
+    execute_on_arena_base>
+#if _CCCL_STD_VER >= 2011
+, thrust::detail::dependencies_aware_execution_policy<
+    execute_on_arena_base>
+#endif
 {
   _CCCL_HOST_DEVICE
   constexpr par_t() : thrust::system::tbb::detail::execution_policy<par_t>() {}
+
+  execute_on_arena on(::tbb::task_arena &arena) const
+  {
+    return execute_on_arena(&arena);
+  }
+
+  execute_on_arena min_parallel_size(std::size_t n) const
+  {
+    return execute_on_arena(0, n);
+  }
 };
 
 
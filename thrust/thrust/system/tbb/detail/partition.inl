@@ -26,7 +26,12 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/tbb/detail/partition.h>
+#include <thrust/system/tbb/detail/for_each_tile.h>
 #include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/detail/internal/parallel_stable_partition.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/partition.h>
+#include <thrust/detail/seq.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,7 +41,6 @@ namespace tbb
 namespace detail
 {
 
-
 template<typename DerivedPolicy,
          typename ForwardIterator,
          typename Predicate>
@@ -45,8 +49,21 @@ template<typename DerivedPolicy,
                                    ForwardIterator last,
                                    Predicate pred)
 {
-  // tbb prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, pred);
+  typedef typename thrust::iterator_value<ForwardIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  const IndexType tiles = num_tiles_for<thrust::system::detail::internal::partition_algorithm, ValueType>(exec, n);
+
+  if(tiles <= 1)
+  {
+    // don't bother parallelizing for small n
+    return thrust::stable_partition(thrust::seq, first, last, pred);
+  }
+
+  // the input doubles as its own stencil
+  return thrust::system::detail::internal::parallel_stable_partition(exec, for_each_tile(exec), first, first, n, tiles, pred);
 } // end stable_partition()
 
 
@@ -60,8 +77,21 @@ template<typename DerivedPolicy,
                                    InputIterator stencil,
                                    Predicate pred)
 {
-  // tbb prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+  typedef typename thrust::iterator_value<ForwardIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  const IndexType tiles = num_tiles_for<thrust::system::detail::internal::partition_algorithm, ValueType>(exec, n);
+
+  if(tiles <= 1)
+  {
+    // don't bother parallelizing for small n
+    return thrust::stable_partition(thrust::seq, first, last, stencil, pred);
+  }
+
+  // only the false elements are buffered, rather than a copy of the whole input
+  return thrust::system::detail::internal::parallel_stable_partition(exec, for_each_tile(exec), first, stencil, n, tiles, pred);
 } // end stable_partition()
 
 template<typename DerivedPolicy,
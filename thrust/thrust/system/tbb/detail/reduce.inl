@@ -31,6 +31,9 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
 #include <thrust/reduce.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/detail/seq.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_reduce.h>
 
@@ -107,25 +110,30 @@ template<typename DerivedPolicy,
          typename InputIterator,
          typename OutputType,
          typename BinaryFunction>
-  OutputType reduce(execution_policy<DerivedPolicy> &,
+  OutputType reduce(execution_policy<DerivedPolicy> &exec,
                     InputIterator begin,
                     InputIterator end,
                     OutputType init,
                     BinaryFunction binary_op)
 {
+  typedef typename thrust::iterator_value<InputIterator>::type      InputType;
   typedef typename thrust::iterator_difference<InputIterator>::type Size;
 
   Size n = thrust::distance(begin, end);
 
-  if (n == 0)
+  if (thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::reduce_algorithm, InputType>(exec, n))
   {
-    return init;
+    // don't bother parallelizing for small n
+    return thrust::reduce(thrust::seq, begin, end, init, binary_op);
   }
   else
   {
     typedef typename reduce_detail::body<InputIterator,OutputType,BinaryFunction> Body;
     Body reduce_body(begin, init, binary_op);
-    ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0,n), reduce_body);
+    execute_in(arena_of(exec), [&]
+    {
+      ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0,n), reduce_body);
+    });
     return binary_op(init, reduce_body.sum);
   }
 }
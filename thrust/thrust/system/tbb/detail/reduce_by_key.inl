@@ -33,11 +33,12 @@
 #include <thrust/detail/minmax.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/range/tail_flags.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 
 #include <cassert>
-#include <thread>
 
 
 THRUST_NAMESPACE_BEGIN
@@ -275,6 +276,7 @@ template<typename DerivedPolicy, typename Iterator1, typename Iterator2, typenam
                   BinaryFunction binary_op)
 {
 
+  typedef typename thrust::iterator_value<Iterator2>::type      value_type;
   typedef typename thrust::iterator_difference<Iterator1>::type difference_type;
   difference_type n = keys_last - keys_first;
   if(n == 0) return thrust::make_pair(keys_result, values_result);
@@ -282,14 +284,14 @@ template<typename DerivedPolicy, typename Iterator1, typename Iterator2, typenam
   // XXX this value is a tuning opportunity
   const difference_type parallelism_threshold = 10000;
 
-  if(n < parallelism_threshold)
+  if(thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::reduce_by_key_algorithm, value_type>(exec, n))
   {
     // don't bother parallelizing for small n
     return thrust::reduce_by_key(thrust::seq, keys_first, keys_last, values_first, keys_result, values_result, binary_pred, binary_op);
   }
 
   // count the number of processors
-  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+  const unsigned int p = max_concurrency(arena_of(exec));
 
   // generate O(P) intervals of sequential work
   // XXX oversubscribing is a tuning opportunity
@@ -317,9 +319,12 @@ template<typename DerivedPolicy, typename Iterator1, typename Iterator2, typenam
   thrust::detail::temporary_array<carry_type, DerivedPolicy> carries(0, exec, num_intervals - 1);
 
   // force grainsize == 1 with simple_partioner()
-  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_intervals, 1),
-    reduce_by_key_detail::make_serial_reduce_by_key_body(keys_first, values_first, interval_output_offsets.begin(), keys_result, values_result, carries.begin(), n, interval_size, num_intervals, binary_pred, binary_op),
-    ::tbb::simple_partitioner());
+  execute_in(arena_of(exec), [&]
+  {
+    ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+      reduce_by_key_detail::make_serial_reduce_by_key_body(keys_first, values_first, interval_output_offsets.begin(), keys_result, values_result, carries.begin(), n, interval_size, num_intervals, binary_pred, binary_op),
+      ::tbb::simple_partitioner());
+  });
 
   difference_type size_of_result = interval_output_offsets[num_intervals];
 
@@ -27,12 +27,15 @@
 #endif // no system header
 #include <thrust/system/tbb/detail/scan.h>
 #include <thrust/distance.h>
-#include <thrust/advance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/function.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/type_traits/function_traits.h>
 #include <thrust/detail/type_traits/iterator/is_output_iterator.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/scan.h>
+#include <thrust/detail/seq.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_scan.h>
 
@@ -200,10 +203,11 @@ struct exclusive_body
 
 } // end scan_detail
 
-template<typename InputIterator,
+template<typename DerivedPolicy,
+         typename InputIterator,
          typename OutputIterator,
          typename BinaryFunction>
-  OutputIterator inclusive_scan(tag,
+  OutputIterator inclusive_scan(execution_policy<DerivedPolicy> &exec,
                                 InputIterator first,
                                 InputIterator last,
                                 OutputIterator result,
@@ -217,23 +221,30 @@ template<typename InputIterator,
   using Size = typename thrust::iterator_difference<InputIterator>::type;
   Size n = thrust::distance(first, last);
 
-  if (n != 0)
+  if (thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::scan_algorithm, ValueType>(exec, n))
+  {
+    // don't bother parallelizing for small n
+    return thrust::inclusive_scan(thrust::seq, first, last, result, binary_op);
+  }
+  else
   {
     typedef typename scan_detail::inclusive_body<InputIterator,OutputIterator,BinaryFunction,ValueType> Body;
     Body scan_body(first, result, binary_op, *first);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0,n), scan_body);
+    execute_in(arena_of(exec), [&]
+    {
+      ::tbb::parallel_scan(::tbb::blocked_range<Size>(0,n), scan_body);
+    });
   }
 
-  thrust::advance(result, n);
-
-  return result;
+  return result + n;
 }
 
-template<typename InputIterator,
+template<typename DerivedPolicy,
+         typename InputIterator,
          typename OutputIterator,
          typename InitialValueType,
          typename BinaryFunction>
-  OutputIterator exclusive_scan(tag,
+  OutputIterator exclusive_scan(execution_policy<DerivedPolicy> &exec,
                                 InputIterator first,
                                 InputIterator last,
                                 OutputIterator result,
@@ -248,16 +259,22 @@ template<typename InputIterator,
   using Size = typename thrust::iterator_difference<InputIterator>::type;
   Size n = thrust::distance(first, last);
 
-  if (n != 0)
+  if (thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::scan_algorithm, ValueType>(exec, n))
+  {
+    // don't bother parallelizing for small n
+    return thrust::exclusive_scan(thrust::seq, first, last, result, init, binary_op);
+  }
+  else
   {
     typedef typename scan_detail::exclusive_body<InputIterator,OutputIterator,BinaryFunction,ValueType> Body;
     Body scan_body(first, result, binary_op, init);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0,n), scan_body);
+    execute_in(arena_of(exec), [&]
+    {
+      ::tbb::parallel_scan(::tbb::blocked_range<Size>(0,n), scan_body);
+    });
   }
 
-  thrust::advance(result, n);
-
-  return result;
+  return result + n;
 }
 
 } // end namespace detail
@@ -0,0 +1,110 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/tbb/detail/scan_by_key.h>
+#include <thrust/system/tbb/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/parallel_scan_by_key.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/scan.h>
+#include <thrust/detail/seq.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan_by_key(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       OutputIterator result,
+                                       BinaryPredicate binary_pred,
+                                       BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_value<InputIterator2>::type      ValueType;
+  typedef typename thrust::iterator_difference<InputIterator1>::type IndexType;
+
+  const IndexType n = last1 - first1;
+
+  const IndexType tiles = num_tiles_for<thrust::system::detail::internal::scan_by_key_algorithm, ValueType>(exec, n);
+
+  if(tiles <= 1)
+  {
+    // don't bother parallelizing for small n
+    return thrust::inclusive_scan_by_key(thrust::seq, first1, last1, first2, result, binary_pred, binary_op);
+  }
+
+  return thrust::system::detail::internal::parallel_inclusive_scan_by_key(exec, for_each_tile(exec), first1, first2, result, n, tiles, binary_pred, binary_op);
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename T,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan_by_key(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       OutputIterator result,
+                                       T init,
+                                       BinaryPredicate binary_pred,
+                                       BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_value<InputIterator2>::type      ValueType;
+  typedef typename thrust::iterator_difference<InputIterator1>::type IndexType;
+
+  const IndexType n = last1 - first1;
+
+  const IndexType tiles = num_tiles_for<thrust::system::detail::internal::scan_by_key_algorithm, ValueType>(exec, n);
+
+  if(tiles <= 1)
+  {
+    // don't bother parallelizing for small n
+    return thrust::exclusive_scan_by_key(thrust::seq, first1, last1, first2, result, init, binary_pred, binary_op);
+  }
+
+  return thrust::system::detail::internal::parallel_exclusive_scan_by_key(exec, for_each_tile(exec), first1, first2, result, n, tiles, init, binary_pred, binary_op);
+}
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
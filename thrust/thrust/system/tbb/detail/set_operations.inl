@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/tbb/detail/set_operations.h>
+#include <thrust/system/tbb/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/parallel_set_operations.h>
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+namespace set_operations_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering,
+         typename SetOperation>
+  OutputIterator set_operation(execution_policy<DerivedPolicy> &exec,
+                               InputIterator1 first1,
+                               InputIterator1 last1,
+                               InputIterator2 first2,
+                               InputIterator2 last2,
+                               OutputIterator result,
+                               StrictWeakOrdering comp,
+                               SetOperation op)
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type      ValueType;
+  typedef typename thrust::iterator_difference<InputIterator1>::type IndexType;
+
+  const IndexType n1 = last1 - first1;
+  const IndexType n2 = last2 - first2;
+
+  const IndexType tiles = num_tiles_for<thrust::system::detail::internal::set_operation_algorithm, ValueType>(exec, n1 + n2);
+
+  if(tiles <= 1)
+  {
+    // don't bother parallelizing for small n
+    return op(first1, last1, first2, last2, result, comp);
+  }
+
+  return thrust::system::detail::internal::parallel_set_operation(exec, for_each_tile(exec), op, first1, n1, first2, n2, result, tiles, comp);
+}
+
+
+} // end set_operations_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_difference(execution_policy<DerivedPolicy> &exec,
+                                InputIterator1 first1,
+                                InputIterator1 last1,
+                                InputIterator2 first2,
+                                InputIterator2 last2,
+                                OutputIterator result,
+                                StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp,
+                                              thrust::system::detail::internal::set_operations_detail::serial_set_difference());
+} // end set_difference()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_intersection(execution_policy<DerivedPolicy> &exec,
+                                  InputIterator1 first1,
+                                  InputIterator1 last1,
+                                  InputIterator2 first2,
+                                  InputIterator2 last2,
+                                  OutputIterator result,
+                                  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp,
+                                              thrust::system::detail::internal::set_operations_detail::serial_set_intersection());
+} // end set_intersection()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_symmetric_difference(execution_policy<DerivedPolicy> &exec,
+                                          InputIterator1 first1,
+                                          InputIterator1 last1,
+                                          InputIterator2 first2,
+                                          InputIterator2 last2,
+                                          OutputIterator result,
+                                          StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp,
+                                              thrust::system::detail::internal::set_operations_detail::serial_set_symmetric_difference());
+} // end set_symmetric_difference()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_union(execution_policy<DerivedPolicy> &exec,
+                           InputIterator1 first1,
+                           InputIterator1 last1,
+                           InputIterator2 first2,
+                           InputIterator2 last2,
+                           OutputIterator result,
+                           StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp,
+                                              thrust::system::detail::internal::set_operations_detail::serial_set_union());
+} // end set_union()
+
+
+} // end detail
+} // end tbb
+} // end system
+THRUST_NAMESPACE_END
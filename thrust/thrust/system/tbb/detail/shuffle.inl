@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2008-2020 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#pragma once
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/tbb/detail/shuffle.h>
+#include <thrust/system/tbb/detail/for_each_tile.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/parallel_shuffle.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/shuffle.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename URBG>
+  void shuffle(execution_policy<DerivedPolicy> &exec,
+               RandomIterator first,
+               RandomIterator last,
+               URBG &&g)
+{
+  typedef typename thrust::iterator_value<RandomIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<RandomIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  if(num_tiles_for<thrust::system::detail::internal::shuffle_algorithm, ValueType>(exec, n) <= 1)
+  {
+    // don't bother parallelizing for small n
+    thrust::shuffle(thrust::seq, first, last, g);
+    return;
+  }
+
+  // the permutation gathers, so it can't be applied in place
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> temp(exec, first, last);
+
+  tbb::detail::shuffle_copy(exec, temp.begin(), temp.end(), first, g);
+} // end shuffle()
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+  void shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &&g)
+{
+  typedef typename thrust::iterator_value<RandomIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<RandomIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  const IndexType tiles = num_tiles_for<thrust::system::detail::internal::shuffle_algorithm, ValueType>(exec, n);
+
+  if(tiles <= 1)
+  {
+    // don't bother parallelizing for small n
+    thrust::shuffle_copy(thrust::seq, first, last, result, g);
+    return;
+  }
+
+  thrust::system::detail::generic::feistel_bijection bijection(n, g);
+
+  thrust::system::detail::internal::parallel_shuffle_copy(exec, for_each_tile(exec), first, n, result, bijection, tiles);
+} // end shuffle_copy()
+
+
+} // end detail
+} // end tbb
+} // end system
+THRUST_NAMESPACE_END
+
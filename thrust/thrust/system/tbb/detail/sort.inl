@@ -32,8 +32,16 @@
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/detail/seq.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/parallel_radix_sort.h>
+#include <thrust/system/tbb/detail/for_each_tile.h>
+#include <thrust/system/tbb/detail/arena.h>
 #include <tbb/parallel_invoke.h>
 
+#include <cstddef>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -45,8 +53,18 @@ namespace sort_detail
 {
 
 
-// TODO tune this based on data type and comp
-const static int threshold = 128 * 1024;
+// the most bytes of keys which a merge sort task sorts sequentially rather
+// than splitting them in two
+const static std::size_t leaf_bytes = 512 * 1024;
+
+
+// the most keys of type T which a merge sort task sorts sequentially; larger
+// keys cost more to move, so fewer of them make a leaf
+template<typename T, typename Size>
+Size leaf_size(void)
+{
+  return static_cast<Size>(thrust::max<std::size_t>(leaf_bytes / sizeof(T), thrust::system::detail::internal::min_parallel_size<thrust::system::detail::internal::sort_algorithm,T>::value));
+}
 
 
 template<typename DerivedPolicy, typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
@@ -76,11 +94,12 @@ struct merge_sort_closure
 template<typename DerivedPolicy, typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
 void merge_sort(execution_policy<DerivedPolicy> &exec, Iterator1 first1, Iterator1 last1, Iterator2 first2, StrictWeakOrdering comp, bool inplace)
 {
+  typedef typename thrust::iterator_value<Iterator1>::type      key_type;
   typedef typename thrust::iterator_difference<Iterator1>::type difference_type;
 
   difference_type n = thrust::distance(first1, last1);
 
-  if (n < threshold)
+  if (n < leaf_size<key_type,difference_type>())
   {
     thrust::stable_sort(thrust::seq, first1, last1, comp);
 
@@ -101,7 +120,10 @@ void merge_sort(execution_policy<DerivedPolicy> &exec, Iterator1 first1, Iterato
   Closure left (exec, first1, mid1,  first2, comp, !inplace);
   Closure right(exec, mid1,   last1, mid2,   comp, !inplace);
 
-  ::tbb::parallel_invoke(left, right);
+  execute_in(arena_of(exec), [&]
+  {
+    ::tbb::parallel_invoke(left, right);
+  });
 
   if(inplace) thrust::merge(exec, first2, mid2, mid2, last2, first1, comp);
   else	      thrust::merge(exec, first1, mid1, mid1, last1, first2, comp);
@@ -115,10 +137,6 @@ namespace sort_by_key_detail
 {
 
 
-// TODO tune this based on data type and comp
-const static int threshold = 128 * 1024;
-
-
 template<typename DerivedPolicy,
          typename Iterator1,
          typename Iterator2,
@@ -184,6 +202,7 @@ void merge_sort_by_key(execution_policy<DerivedPolicy> &exec,
                        StrictWeakOrdering comp,
                        bool inplace)
 {
+  typedef typename thrust::iterator_value<Iterator1>::type      key_type;
   typedef typename thrust::iterator_difference<Iterator1>::type difference_type;
 
   difference_type n = thrust::distance(first1, last1);
@@ -195,7 +214,7 @@ void merge_sort_by_key(execution_policy<DerivedPolicy> &exec,
   Iterator2 last2 = first2 + n;
   Iterator3 last3 = first3 + n;
 
-  if (n < threshold)
+  if (n < sort_detail::leaf_size<key_type,difference_type>())
   {
     thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
 
@@ -213,7 +232,10 @@ void merge_sort_by_key(execution_policy<DerivedPolicy> &exec,
   Closure left (exec, first1, mid1,  first2, first3, first4, comp, !inplace);
   Closure right(exec, mid1,   last1, mid2,   mid3,   mid4,   comp, !inplace);
 
-  ::tbb::parallel_invoke(left, right);
+  execute_in(arena_of(exec), [&]
+  {
+    ::tbb::parallel_invoke(left, right);
+  });
 
   if(inplace)
   {
@@ -229,6 +251,488 @@ void merge_sort_by_key(execution_policy<DerivedPolicy> &exec,
 } // end namespace sort_detail
 
 
+namespace sample_sort_detail
+{
+
+
+// the keys sampled per bucket to choose the splitters from; more samples even
+// out the buckets at the cost of sorting a larger sample
+const static std::size_t oversampling = 16;
+
+// the most buckets of a sample sort; every tile keeps a count per bucket
+const static std::size_t max_buckets = 1024;
+
+
+// the number of buckets to sample sort n keys of type T into: about one per
+// merge sort leaf, so that a bucket stays in cache while it's sorted, but at
+// least a few per thread of exec's arena so that they balance. Fewer than two
+// means the keys are better off merge sorted.
+template<typename T, typename DerivedPolicy, typename Size>
+Size num_buckets(execution_policy<DerivedPolicy> &exec, Size n)
+{
+  const Size leaf = sort_detail::leaf_size<T,Size>();
+
+  if(n < 2 * leaf)
+  {
+    return 1;
+  }
+
+  const Size p = static_cast<Size>(max_concurrency(arena_of(exec)));
+
+  Size result = thrust::max<Size>(n / leaf, 4 * p);
+  result = thrust::min<Size>(result, static_cast<Size>(max_buckets));
+
+  // there must be enough keys to sample
+  return thrust::min<Size>(result, n / static_cast<Size>(oversampling));
+}
+
+
+// the bucket of a key, i.e. the number of splitters which don't order after
+// it, so that equivalent keys share a bucket
+template<typename KeyType, typename Size, typename StrictWeakOrdering>
+struct bucket_of
+{
+  const KeyType     *splitters;
+  Size               num_splitters;
+  StrictWeakOrdering comp;
+
+  bucket_of(const KeyType *splitters, Size num_splitters, StrictWeakOrdering comp)
+    : splitters(splitters), num_splitters(num_splitters), comp(comp)
+  {}
+
+  // the search is branchless, as the branches of a binary search over random
+  // keys are taken half the time
+  Size operator()(const KeyType &key)
+  {
+    if(num_splitters == 0)
+    {
+      return 0;
+    }
+
+    const KeyType *first = splitters;
+    Size count = num_splitters;
+
+    while(count > 1)
+    {
+      Size half = count / 2;
+
+      first = comp(key, first[half]) ? first : first + half;
+      count -= half;
+    }
+
+    return static_cast<Size>(first - splitters) + (comp(key, *first) ? 0 : 1);
+  }
+};
+
+
+// counts the keys of one tile in each bucket
+template<typename RandomAccessIterator, typename KeyType, typename Size, typename StrictWeakOrdering>
+struct count_buckets
+{
+  RandomAccessIterator                         keys;
+  thrust::system::detail::internal::uniform_decomposition<Size> tiles;
+  bucket_of<KeyType,Size,StrictWeakOrdering>   bucket;
+  Size                                        *counts;
+
+  count_buckets(RandomAccessIterator keys,
+                thrust::system::detail::internal::uniform_decomposition<Size> tiles,
+                bucket_of<KeyType,Size,StrictWeakOrdering> bucket,
+                Size *counts)
+    : keys(keys), tiles(tiles), bucket(bucket), counts(counts)
+  {}
+
+  void operator()(Size tile) const
+  {
+    const Size num_buckets = bucket.num_splitters + 1;
+
+    Size *tile_counts = counts + tile * num_buckets;
+
+    for(Size b = 0; b < num_buckets; ++b)
+    {
+      tile_counts[b] = 0;
+    }
+
+    bucket_of<KeyType,Size,StrictWeakOrdering> bucket_of_key = bucket;
+
+    thrust::system::detail::internal::index_range<Size> range = tiles[tile];
+
+    for(Size i = range.begin(); i < range.end(); ++i)
+    {
+      ++tile_counts[bucket_of_key(keys[i])];
+    }
+  }
+};
+
+
+// moves the keys (and values) of one tile to their positions in the buckets
+template<bool HasValues,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename KeyType,
+         typename ValueType,
+         typename Size,
+         typename StrictWeakOrdering>
+struct scatter_buckets
+{
+  RandomAccessIterator1                        keys_first;
+  RandomAccessIterator2                        values_first;
+  KeyType                                     *keys_result;
+  ValueType                                   *values_result;
+  thrust::system::detail::internal::uniform_decomposition<Size> tiles;
+  bucket_of<KeyType,Size,StrictWeakOrdering>   bucket;
+  Size                                        *offsets;
+
+  scatter_buckets(RandomAccessIterator1 keys_first,
+                  RandomAccessIterator2 values_first,
+                  KeyType *keys_result,
+                  ValueType *values_result,
+                  thrust::system::detail::internal::uniform_decomposition<Size> tiles,
+                  bucket_of<KeyType,Size,StrictWeakOrdering> bucket,
+                  Size *offsets)
+    : keys_first(keys_first), values_first(values_first),
+      keys_result(keys_result), values_result(values_result),
+      tiles(tiles), bucket(bucket), offsets(offsets)
+  {}
+
+  void operator()(Size tile) const
+  {
+    Size *tile_offsets = offsets + tile * (bucket.num_splitters + 1);
+
+    bucket_of<KeyType,Size,StrictWeakOrdering> bucket_of_key = bucket;
+
+    thrust::system::detail::internal::index_range<Size> range = tiles[tile];
+
+    for(Size i = range.begin(); i < range.end(); ++i)
+    {
+      KeyType key = keys_first[i];
+      Size &dst = tile_offsets[bucket_of_key(key)];
+
+      keys_result[dst] = key;
+
+      if(HasValues)
+      {
+        values_result[dst] = values_first[i];
+      }
+
+      ++dst;
+    }
+  }
+};
+
+
+// sorts the keys (and values) of one bucket and moves them back to the input
+template<bool HasValues,
+         typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename KeyType,
+         typename ValueType,
+         typename Size,
+         typename StrictWeakOrdering>
+struct sort_buckets
+{
+  execution_policy<DerivedPolicy> &exec;
+  RandomAccessIterator1            keys_first;
+  RandomAccessIterator2            values_first;
+  KeyType                         *keys_temp;
+  ValueType                       *values_temp;
+  const Size                      *bucket_begin;
+  Size                             max_bucket_size;
+  StrictWeakOrdering               comp;
+
+  sort_buckets(execution_policy<DerivedPolicy> &exec,
+               RandomAccessIterator1 keys_first,
+               RandomAccessIterator2 values_first,
+               KeyType *keys_temp,
+               ValueType *values_temp,
+               const Size *bucket_begin,
+               Size max_bucket_size,
+               StrictWeakOrdering comp)
+    : exec(exec), keys_first(keys_first), values_first(values_first),
+      keys_temp(keys_temp), values_temp(values_temp),
+      bucket_begin(bucket_begin), max_bucket_size(max_bucket_size), comp(comp)
+  {}
+
+  void operator()(Size bucket) const
+  {
+    sort_bucket(bucket_begin[bucket], bucket_begin[bucket + 1], thrust::detail::integral_constant<bool,HasValues>());
+  }
+
+  // Buckets far larger than their share are full of keys equivalent to a
+  // splitter, so they're merge sorted in parallel; the merge sort leaves the
+  // keys in their place in the input when it isn't told to sort in place.
+  void sort_bucket(Size begin, Size end, thrust::detail::false_type) const
+  {
+    if(end - begin > max_bucket_size)
+    {
+      sort_detail::merge_sort(exec, keys_temp + begin, keys_temp + end, keys_first + begin, comp, false);
+      return;
+    }
+
+    thrust::stable_sort(thrust::seq, keys_temp + begin, keys_temp + end, comp);
+    thrust::copy(thrust::seq, keys_temp + begin, keys_temp + end, keys_first + begin);
+  }
+
+  void sort_bucket(Size begin, Size end, thrust::detail::true_type) const
+  {
+    if(end - begin > max_bucket_size)
+    {
+      sort_by_key_detail::merge_sort_by_key(exec, keys_temp + begin, keys_temp + end, values_temp + begin, keys_first + begin, values_first + begin, comp, false);
+      return;
+    }
+
+    thrust::stable_sort_by_key(thrust::seq, keys_temp + begin, keys_temp + end, values_temp + begin, comp);
+    thrust::copy(thrust::seq, keys_temp + begin, keys_temp + end, keys_first + begin);
+    thrust::copy(thrust::seq, values_temp + begin, values_temp + end, values_first + begin);
+  }
+};
+
+
+// Turns the per-tile bucket counts (tile-major) into the position at which
+// each tile writes its first key of each bucket, scanning them bucket-major so
+// that tiles keep their relative order within each bucket, and records where
+// each bucket begins.
+template<typename Size>
+void exclusive_scan_counts(Size *counts, Size num_tiles, Size num_buckets, Size *bucket_begin)
+{
+  Size sum = 0;
+
+  for(Size b = 0; b < num_buckets; ++b)
+  {
+    bucket_begin[b] = sum;
+
+    for(Size t = 0; t < num_tiles; ++t)
+    {
+      Size count = counts[t * num_buckets + b];
+      counts[t * num_buckets + b] = sum;
+      sum += count;
+    }
+  }
+
+  bucket_begin[num_buckets] = sum;
+}
+
+
+// Stable sample sort of [keys_first, keys_first + n) into num_buckets
+// buckets, permuting [values_first, values_first + n) alongside when
+// HasValues is true.
+//
+// The splitters between the buckets are every oversampling'th key of a sorted
+// sample taken at regular intervals of the input. Every tile of the input
+// counts its keys in each bucket, the counts are scanned bucket-major, and
+// every tile scatters its keys to its own positions in a temporary buffer, so
+// that equivalent keys keep their order. Each bucket is then sorted on its own
+// and moved back, while it's still in cache.
+template<bool HasValues,
+         typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+void sample_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator2 values_first,
+                 Size n,
+                 Size num_buckets,
+                 StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type ValueType;
+
+  // choose the splitters
+  const Size num_samples = num_buckets * static_cast<Size>(oversampling);
+  const Size stride      = n / num_samples;
+
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> samples(exec, num_samples);
+
+  KeyType *splitters = thrust::raw_pointer_cast(samples.data());
+
+  for(Size i = 0; i < num_samples; ++i)
+  {
+    splitters[i] = keys_first[i * stride + stride / 2];
+  }
+
+  thrust::stable_sort(thrust::seq, splitters, splitters + num_samples, comp);
+
+  for(Size b = 0; b + 1 < num_buckets; ++b)
+  {
+    splitters[b] = splitters[(b + 1) * static_cast<Size>(oversampling)];
+  }
+
+  bucket_of<KeyType,Size,StrictWeakOrdering> bucket(splitters, num_buckets - 1, comp);
+
+  // count the keys of each tile in each bucket
+  const Size leaf = sort_detail::leaf_size<KeyType,Size>();
+
+  thrust::system::detail::internal::uniform_decomposition<Size> tiles(n, 1, num_tiles(exec, n, leaf));
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> counts(0, exec, tiles.size() * num_buckets + num_buckets + 1);
+
+  Size *counts_buffer = thrust::raw_pointer_cast(counts.data());
+  Size *bucket_begin  = counts_buffer + tiles.size() * num_buckets;
+
+  for_each_tile for_each(exec);
+
+  for_each(tiles.size(), count_buckets<RandomAccessIterator1,KeyType,Size,StrictWeakOrdering>(keys_first, tiles, bucket, counts_buffer));
+
+  exclusive_scan_counts(counts_buffer, tiles.size(), num_buckets, bucket_begin);
+
+  // scatter the keys to their buckets
+  thrust::detail::temporary_array<KeyType,DerivedPolicy>   keys_temp(exec, n);
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> values_temp(exec, HasValues ? n : 0);
+
+  KeyType   *keys_buffer   = thrust::raw_pointer_cast(keys_temp.data());
+  ValueType *values_buffer = thrust::raw_pointer_cast(values_temp.data());
+
+  for_each(tiles.size(),
+           scatter_buckets<HasValues,RandomAccessIterator1,RandomAccessIterator2,KeyType,ValueType,Size,StrictWeakOrdering>
+             (keys_first, values_first, keys_buffer, values_buffer, tiles, bucket, counts_buffer));
+
+  // sort each bucket
+  const Size max_bucket_size = thrust::max<Size>(leaf, 4 * (n / num_buckets));
+
+  for_each(num_buckets,
+           sort_buckets<HasValues,DerivedPolicy,RandomAccessIterator1,RandomAccessIterator2,KeyType,ValueType,Size,StrictWeakOrdering>
+             (exec, keys_first, values_first, keys_buffer, values_buffer, bucket_begin, max_bucket_size, comp));
+}
+
+
+} // end namespace sample_sort_detail
+
+
+namespace radix_sort_detail
+{
+
+
+// each pass of the radix sort reads a private histogram per tile, so below
+// this size the sequential radix sort is faster
+const static int threshold = 128 * 1024;
+
+
+} // end namespace radix_sort_detail
+
+
+namespace sort_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type) // use sample sort
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      key_type;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  difference_type n = thrust::distance(first, last);
+  difference_type buckets = sample_sort_detail::num_buckets<key_type>(exec, n);
+
+  if(buckets >= 2)
+  {
+    sample_sort_detail::sample_sort<false>(exec, first, static_cast<int*>(0), n, buckets, comp);
+    return;
+  }
+
+  // too few keys to sample, so merge sort them
+  thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
+
+  sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type) // use radix sort
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  difference_type n = thrust::distance(first, last);
+  difference_type tiles = num_tiles(exec, n, difference_type(radix_sort_detail::threshold));
+
+  if(tiles <= 1)
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  thrust::system::detail::internal::parallel_radix_sort<false>
+    (exec, for_each_tile(exec), first, static_cast<int*>(0), n, tiles, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 first1,
+                        RandomAccessIterator1 last1,
+                        RandomAccessIterator2 first2,
+                        StrictWeakOrdering comp,
+                        thrust::detail::false_type) // use sample sort
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      key_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      val_type;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type difference_type;
+
+  difference_type n = thrust::distance(first1, last1);
+  difference_type buckets = sample_sort_detail::num_buckets<key_type>(exec, n);
+
+  if(buckets >= 2)
+  {
+    sample_sort_detail::sample_sort<true>(exec, first1, first2, n, buckets, comp);
+    return;
+  }
+
+  // too few keys to sample, so merge sort them
+  RandomAccessIterator2 last2 = first2 + n;
+
+  thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
+  thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, first2, last2);
+
+  sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 first1,
+                        RandomAccessIterator1 last1,
+                        RandomAccessIterator2 first2,
+                        StrictWeakOrdering comp,
+                        thrust::detail::true_type) // use radix sort
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type difference_type;
+
+  difference_type n = thrust::distance(first1, last1);
+  difference_type tiles = num_tiles(exec, n, difference_type(radix_sort_detail::threshold));
+
+  if(tiles <= 1)
+  {
+    thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
+    return;
+  }
+
+  thrust::system::detail::internal::parallel_radix_sort<true>
+    (exec, for_each_tile(exec), first1, first2, n, tiles, comp);
+}
+
+
+} // end namespace sort_detail
+
+
 template<typename DerivedPolicy,
          typename RandomAccessIterator,
          typename StrictWeakOrdering>
@@ -239,9 +743,16 @@ void stable_sort(execution_policy<DerivedPolicy> &exec,
 {
   typedef typename thrust::iterator_value<RandomAccessIterator>::type key_type;
 
-  thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
+  if(thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::sort_algorithm, key_type>(exec, thrust::distance(first, last)))
+  {
+    // don't bother parallelizing for small n
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
 
-  sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+  // primitive keys compared with less or greater are radix sorted
+  sort_detail::stable_sort(exec, first, last, comp,
+    thrust::system::detail::internal::use_parallel_radix_sort<key_type,StrictWeakOrdering>());
 }
 
 
@@ -256,14 +767,17 @@ template<typename DerivedPolicy,
                           StrictWeakOrdering comp)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type key_type;
-  typedef typename thrust::iterator_value<RandomAccessIterator2>::type val_type;
-
-  RandomAccessIterator2 last2 = first2 + thrust::distance(first1, last1);
 
-  thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
-  thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, first2, last2);
+  if(thrust::system::detail::internal::below_min_parallel_size<thrust::system::detail::internal::sort_algorithm, key_type>(exec, thrust::distance(first1, last1)))
+  {
+    // don't bother parallelizing for small n
+    thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
+    return;
+  }
 
-  sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+  // primitive keys compared with less or greater are radix sorted
+  sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp,
+    thrust::system::detail::internal::use_parallel_radix_sort<key_type,StrictWeakOrdering>());
 }
 
 
@@ -147,6 +147,20 @@ struct tag : thrust::system::tbb::execution_policy<tag> { unspecified };
  *
  *  // 0 1 2 is printed to standard output in some unspecified order
  *  \endcode
+ *
+ *  <tt>par.on(arena)</tt> returns a policy whose algorithms run in the \p tbb::task_arena \p arena,
+ *  which must outlive them. The arena's concurrency limit and constraints, such as its NUMA node,
+ *  bound the threads the algorithms use:
+ *
+ *  \code
+ *  tbb::task_arena arena(8);
+ *  thrust::sort(thrust::tbb::par.on(arena), vec.begin(), vec.end());
+ *  \endcode
+ *
+ *  An algorithm given fewer elements than it is worth spawning tasks for runs sequentially on
+ *  the calling thread instead. The cutoff depends on the algorithm and the type of its elements;
+ *  <tt>par.min_parallel_size(n)</tt> returns a policy whose algorithms use the cutoff \p n
+ *  instead, and <tt>par.on(arena).min_parallel_size(n)</tt> does so in \p arena.
  */
 static const unspecified par;
 
@@ -0,0 +1,77 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/threads/detail/copy_if.h>
+#include <thrust/system/threads/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/parallel_copy_if.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/distance.h>
+#include <thrust/copy.h>
+#include <thrust/detail/seq.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace threads
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename Predicate>
+  OutputIterator copy_if(execution_policy<DerivedPolicy> &exec,
+                         InputIterator1 first,
+                         InputIterator1 last,
+                         InputIterator2 stencil,
+                         OutputIterator result,
+                         Predicate pred)
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type      ValueType;
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+
+  Size n = thrust::distance(first, last);
+
+  const Size tiles = num_tiles_for<thrust::system::detail::internal::copy_if_algorithm, ValueType>(exec, n);
+
+  // a single tile has no parallelism to exploit
+  if(tiles <= 1)
+  {
+    return thrust::copy_if(thrust::seq, first, last, stencil, result, pred);
+  }
+
+  return thrust::system::detail::internal::parallel_copy_if(exec, for_each_tile(exec), first, stencil, result, n, tiles, pred);
+} // end copy_if()
+
+
+} // end namespace detail
+} // end namespace threads
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,69 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/threads/detail/execution_policy.h>
+#include <thrust/system/threads/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/parallel_find_if.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/find.h>
+#include <thrust/detail/seq.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace threads
+{
+namespace detail
+{
+template <typename DerivedPolicy, typename InputIterator, typename Predicate>
+InputIterator find_if(execution_policy<DerivedPolicy> &exec,
+                      InputIterator first,
+                      InputIterator last,
+                      Predicate pred)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type n = last - first;
+
+  const difference_type num_workers = num_tiles_for<thrust::system::detail::internal::find_algorithm, value_type>(exec, n);
+
+  if(num_workers <= 1)
+  {
+    // don't bother parallelizing for small n
+    return thrust::find_if(thrust::seq, first, last, pred);
+  }
+
+  // the workers stop claiming input once one of them finds a match before it
+  return thrust::system::detail::internal::parallel_find_if(for_each_tile(exec), first, n, num_workers, pred);
+}
+
+} // end namespace detail
+} // end namespace threads
+} // end namespace system
+THRUST_NAMESPACE_END
+
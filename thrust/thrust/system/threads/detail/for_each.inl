@@ -0,0 +1,116 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/threads/detail/for_each_tile.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace threads
+{
+namespace detail
+{
+namespace for_each_detail
+{
+
+
+// the cost of visiting an element varies with f, so split finely enough for
+// the threads which finish early to steal work from the others
+const static int tiles_per_thread = 8;
+
+
+template<typename RandomAccessIterator,
+         typename Size,
+         typename UnaryFunction>
+  struct body
+{
+  RandomAccessIterator m_first;
+  thrust::system::detail::internal::uniform_decomposition<Size> m_tiles;
+  UnaryFunction m_f;
+
+  body(RandomAccessIterator first, thrust::system::detail::internal::uniform_decomposition<Size> tiles, UnaryFunction f)
+    : m_first(first), m_tiles(tiles), m_f(f)
+  {}
+
+  void operator()(Size tile) const
+  {
+    thrust::for_each_n(thrust::system::detail::sequential::seq, m_first + m_tiles[tile].begin(), m_tiles[tile].size(), m_f);
+  } // end operator()()
+}; // end body
+
+
+} // end for_each_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename Size,
+         typename UnaryFunction>
+RandomAccessIterator for_each_n(execution_policy<DerivedPolicy> &exec,
+                                RandomAccessIterator first,
+                                Size n,
+                                UnaryFunction f)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  const Size tiles = num_tiles_for<thrust::system::detail::internal::for_each_algorithm, value_type>(exec, n, Size(for_each_detail::tiles_per_thread));
+
+  if(tiles <= 1)
+  {
+    return thrust::for_each_n(thrust::system::detail::sequential::seq, first, n, f);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp(n, 1, tiles);
+
+  parallel_for(exec, decomp.size(), for_each_detail::body<RandomAccessIterator,Size,UnaryFunction>(first, decomp, f));
+
+  // return the end of the range
+  return first + n;
+} // end for_each_n
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename UnaryFunction>
+  RandomAccessIterator for_each(execution_policy<DerivedPolicy> &s,
+                                RandomAccessIterator first,
+                                RandomAccessIterator last,
+                                UnaryFunction f)
+{
+  return threads::detail::for_each_n(s, first, thrust::distance(first,last), f);
+} // end for_each()
+
+
+} // end namespace detail
+} // end namespace threads
+} // end namespace system
+THRUST_NAMESPACE_END
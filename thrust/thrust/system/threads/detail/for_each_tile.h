@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/system/threads/detail/execution_policy.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+#include <thrust/system/threads/detail/thread_pool.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace threads
+{
+namespace detail
+{
+
+
+// runs f(tile) for every tile in [0, num_tiles) as its own task of the thread
+// pool
+template<typename DerivedPolicy, typename Size, typename Function>
+void parallel_for(execution_policy<DerivedPolicy> &, Size num_tiles, Function f)
+{
+  thread_pool::instance().parallel_for(num_tiles, f);
+}
+
+
+// the same as a callable, as the tiled engines in
+// thrust/system/detail/internal expect
+struct for_each_tile
+{
+  template<typename DerivedPolicy>
+  explicit for_each_tile(execution_policy<DerivedPolicy> &)
+  {}
+
+  template<typename Size, typename Function>
+  void operator()(Size num_tiles, Function f) const
+  {
+    thread_pool::instance().parallel_for(num_tiles, f);
+  }
+};
+
+
+// the number of tiles to split n elements into, tiles_per_thread per thread of
+// the pool but none smaller than min_tile_size; more than one tile per thread
+// leaves work to steal when tiles take unequal time
+template<typename DerivedPolicy, typename Size>
+Size num_tiles(execution_policy<DerivedPolicy> &, Size n, Size min_tile_size, Size tiles_per_thread = 1)
+{
+  const Size p = static_cast<Size>(thread_pool::instance().size());
+
+  return thrust::max<Size>(1, thrust::min<Size>(tiles_per_thread * p, n / min_tile_size));
+}
+
+
+// the number of tiles to split n elements of type T into for Algorithm: one
+// below exec's min_parallel_size for it, otherwise tiles_per_thread per thread
+// of the pool but none smaller than half that size
+template<typename Algorithm, typename T, typename DerivedPolicy, typename Size>
+Size num_tiles_for(execution_policy<DerivedPolicy> &exec, Size n, Size tiles_per_thread = 1)
+{
+  if(thrust::system::detail::internal::below_min_parallel_size<Algorithm,T>(exec, n))
+  {
+    return 1;
+  }
+
+  const Size min_size = static_cast<Size>(thrust::system::detail::internal::min_parallel_size_of<Algorithm,T>(exec));
+
+  return num_tiles(exec, n, thrust::max<Size>(1, min_size / 2), tiles_per_thread);
+}
+
+
+} // end namespace detail
+} // end namespace threads
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2008-2018 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/allocator_aware_execution_policy.h>
+#if _CCCL_STD_VER >= 2011
+#  include <thrust/detail/dependencies_aware_execution_policy.h>
+#endif
+#include <thrust/system/threads/detail/execution_policy.h>
+#include <thrust/system/detail/internal/min_parallel_size.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace threads
+{
+namespace detail
+{
+
+
+// a threads policy whose algorithms run sequentially below a given input
+// size
+template<typename Derived>
+struct execute_with_options_base : thrust::system::threads::detail::execution_policy<Derived>
+{
+private:
+  std::size_t min_size;
+
+public:
+  _CCCL_HOST_DEVICE
+  constexpr execute_with_options_base(std::size_t min_size_ = 0)
+    : min_size(min_size_)
+  {}
+
+  Derived min_parallel_size(std::size_t n) const
+  {
+    Derived result  = thrust::detail::derived_cast(*this);
+    result.min_size = n;
+    return result;
+  }
+
+private:
+  friend std::size_t get_min_parallel_size(const execute_with_options_base &exec)
+  {
+    return exec.min_size;
+  }
+};
+
+
+struct execute_with_options : execute_with_options_base<execute_with_options>
+{
+  typedef execute_with_options_base<execute_with_options> base_t;
+
+  _CCCL_HOST_DEVICE
+  constexpr execute_with_options() : base_t() {}
+
+  _CCCL_HOST_DEVICE
+  constexpr execute_with_options(std::size_t min_size) : base_t(min_size) {}
+};
+
+
+struct par_t : thrust::system::threads::detail::execution_policy<par_t>,
+  thrust::detail::allocator_aware_execution_policy<
+    execute_with_options_base>
+#if _CCCL_STD_VER >= 2011
+, thrust::detail::dependencies_aware_execution_policy<
+    execute_with_options_base>
+#endif
+{
+  _CCCL_HOST_DEVICE
+  constexpr par_t() : thrust::system::threads::detail::execution_policy<par_t>() {}
+
+  execute_with_options min_parallel_size(std::size_t n) const
+  {
+    return execute_with_options(n);
+  }
+};
+
+
+} // end detail
+
+
+static const detail::par_t par;
+
+
+} // end threads
+} // end system
+
+
+// alias par here
+namespace threads
+{
+
+
+using thrust::system::threads::par;
+
+
+} // end threads
+THRUST_NAMESPACE_END
+
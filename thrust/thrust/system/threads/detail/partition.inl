@@ -0,0 +1,139 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/threads/detail/partition.h>
+#include <thrust/system/threads/detail/for_each_tile.h>
+#include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/detail/internal/parallel_stable_partition.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/partition.h>
+#include <thrust/detail/seq.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace threads
+{
+namespace detail
+{
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Predicate>
+  ForwardIterator stable_partition(execution_policy<DerivedPolicy> &exec,
+                                   ForwardIterator first,
+                                   ForwardIterator last,
+                                   Predicate pred)
+{
+  typedef typename thrust::iterator_value<ForwardIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  const IndexType tiles = num_tiles_for<thrust::system::detail::internal::partition_algorithm, ValueType>(exec, n);
+
+  if(tiles <= 1)
+  {
+    // don't bother parallelizing for small n
+    return thrust::stable_partition(thrust::seq, first, last, pred);
+  }
+
+  // the input doubles as its own stencil
+  return thrust::system::detail::internal::parallel_stable_partition(exec, for_each_tile(exec), first, first, n, tiles, pred);
+} // end stable_partition()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename Predicate>
+  ForwardIterator stable_partition(execution_policy<DerivedPolicy> &exec,
+                                   ForwardIterator first,
+                                   ForwardIterator last,
+                                   InputIterator stencil,
+                                   Predicate pred)
+{
+  typedef typename thrust::iterator_value<ForwardIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  const IndexType n = last - first;
+
+  const IndexType tiles = num_tiles_for<thrust::system::detail::internal::partition_algorithm, ValueType>(exec, n);
+
+  if(tiles <= 1)
+  {
+    // don't bother parallelizing for small n
+    return thrust::stable_partition(thrust::seq, first, last, stencil, pred);
+  }
+
+  // only the false elements are buffered, rather than a copy of the whole input
+  return thrust::system::detail::internal::parallel_stable_partition(exec, for_each_tile(exec), first, stencil, n, tiles, pred);
+} // end stable_partition()
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename Predicate>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    stable_partition_copy(execution_policy<DerivedPolicy> &exec,
+                          InputIterator first,
+                          InputIterator last,
+                          OutputIterator1 out_true,
+                          OutputIterator2 out_false,
+                          Predicate pred)
+{
+  // threads prefers generic::stable_partition_copy to cpp::stable_partition_copy
+  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+} // end stable_partition_copy()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename Predicate>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    stable_partition_copy(execution_policy<DerivedPolicy> &exec,
+                          InputIterator1 first,
+                          InputIterator1 last,
+                          InputIterator2 stencil,
+                          OutputIterator1 out_true,
+                          OutputIterator2 out_false,
+                          Predicate pred)
+{
+  // threads prefers generic::stable_partition_copy to cpp::stable_partition_copy
+  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+} // end stable_partition_copy()
+
+
+} // end namespace detail
+} // end namespace threads
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,76 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/distance.h>
+#include <thrust/reduce.h>
+#include <thrust/detail/seq.h>
+#include <thrust/system/threads/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/parallel_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace threads
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputType,
+         typename BinaryFunction>
+  OutputType reduce(execution_policy<DerivedPolicy> &exec,
+                    InputIterator begin,
+                    InputIterator end,
+                    OutputType init,
+                    BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<InputIterator>::type Size;
+
+  Size n = thrust::distance(begin, end);
+
+  // split finely enough for the threads which finish early to steal work from
+  // the others
+  const Size tiles = num_tiles_for<thrust::system::detail::internal::reduce_algorithm, ValueType>(exec, n, Size(4));
+
+  if(tiles <= 1)
+  {
+    return thrust::reduce(thrust::seq, begin, end, init, binary_op);
+  }
+
+  return thrust::system::detail::internal::parallel_reduce(exec, for_each_tile(exec), begin, n, tiles, init, binary_op);
+}
+
+
+} // end namespace detail
+} // end namespace threads
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/threads/detail/scan.h>
+#include <thrust/system/threads/detail/for_each_tile.h>
+#include <thrust/system/detail/internal/parallel_scan.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/seq.h>
+#include <thrust/scan.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace threads
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                BinaryFunction binary_op)
+{
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = typename thrust::iterator_value<InputIterator>::type;
+
+  using Size = typename thrust::iterator_difference<InputIterator>::type;
+  Size n = thrust::distance(first, last);
+
+  const Size tiles = num_tiles_for<thrust::system::detail::internal::scan_algorithm, ValueType>(exec, n);
+
+  // a single tile has no parallelism to exploit
+  if(tiles <= 1)
+  {
+    return thrust::inclusive_scan(thrust::seq, first, last, result, binary_op);
+  }
+
+  return thrust::system::detail::internal::parallel_inclusive_scan(exec, for_each_tile(exec), first, result, n, tiles, binary_op);
+}
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename InitialValueType,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                InitialValueType init,
+                                BinaryFunction binary_op)
+{
+  // Use the initial value type per https://wg21.link/P0571
+  using ValueType = InitialValueType;
+
+  using Size = typename thrust::iterator_difference<InputIterator>::type;
+  Size n = thrust::distance(first, last);
+
+  const Size tiles = num_tiles_for<thrust::system::detail::internal::scan_algorithm, ValueType>(exec, n);
+
+  // a single tile has no parallelism to exploit
+  if(tiles <= 1)
+  {
+    return thrust::exclusive_scan(thrust::seq, first, last, result, init, binary_op);
+  }
+
+  return thrust::system::detail::internal::parallel_exclusive_scan(exec, for_each_tile(exec), first, result, n, tiles, init, binary_op);
+}
+
+
+} // end namespace detail
+} // end namespace threads
+} // end namespace system
+THRUST_NAMESPACE_END
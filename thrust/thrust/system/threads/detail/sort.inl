@@ -0,0 +1,174 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/sort.h>
+#include <thrust/detail/seq.h>
+#include <thrust/system/detail/internal/parallel_merge_sort.h>
+#include <thrust/system/detail/internal/parallel_radix_sort.h>
+#include <thrust/system/threads/detail/for_each_tile.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace threads
+{
+namespace detail
+{
+namespace sort_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 Size n,
+                 Size tiles,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type) // use merge sort
+{
+  thrust::system::detail::internal::parallel_merge_sort(exec, for_each_tile(exec), first, n, tiles, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 Size n,
+                 Size tiles,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type) // use radix sort
+{
+  thrust::system::detail::internal::parallel_radix_sort<false>
+    (exec, for_each_tile(exec), first, static_cast<int*>(0), n, tiles, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator2 values_first,
+                        Size n,
+                        Size tiles,
+                        StrictWeakOrdering comp,
+                        thrust::detail::false_type) // use merge sort
+{
+  thrust::system::detail::internal::parallel_merge_sort_by_key(exec, for_each_tile(exec), keys_first, values_first, n, tiles, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator2 values_first,
+                        Size n,
+                        Size tiles,
+                        StrictWeakOrdering comp,
+                        thrust::detail::true_type) // use radix sort
+{
+  thrust::system::detail::internal::parallel_radix_sort<true>
+    (exec, for_each_tile(exec), keys_first, values_first, n, tiles, comp);
+}
+
+
+} // end namespace sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      key_type;
+
+  const Size n = last - first;
+
+  const Size tiles = num_tiles_for<thrust::system::detail::internal::sort_algorithm, key_type>(exec, n);
+
+  if(tiles <= 1)
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  // primitive keys compared with less or greater are radix sorted
+  sort_detail::stable_sort(exec, first, n, tiles, comp,
+    thrust::system::detail::internal::use_parallel_radix_sort<key_type,StrictWeakOrdering>());
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 first1,
+                          RandomAccessIterator1 last1,
+                          RandomAccessIterator2 first2,
+                          StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      key_type;
+
+  const Size n = last1 - first1;
+
+  const Size tiles = num_tiles_for<thrust::system::detail::internal::sort_algorithm, key_type>(exec, n);
+
+  if(tiles <= 1)
+  {
+    thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
+    return;
+  }
+
+  // primitive keys compared with less or greater are radix sorted
+  sort_detail::stable_sort_by_key(exec, first1, first2, n, tiles, comp,
+    thrust::system::detail::internal::use_parallel_radix_sort<key_type,StrictWeakOrdering>());
+}
+
+
+} // end namespace detail
+} // end namespace threads
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,369 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thread_pool.h
+ *  \brief The pool of threads the std::thread backend's algorithms run on.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/memory_wrapper.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace threads
+{
+namespace detail
+{
+namespace thread_pool_detail
+{
+
+
+// The tasks of a job which are left to one thread of the pool, a contiguous
+// range of task indices. Its owner takes tasks from the front, one at a time,
+// while idle threads steal the back half.
+struct task_deque
+{
+  std::mutex mutex;
+  std::size_t first;
+  std::size_t last;
+
+  // keep the deques of different threads on different cache lines
+  char padding[64];
+
+  task_deque() : first(0), last(0) {}
+
+  void assign(std::size_t first_, std::size_t last_)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    first = first_;
+    last  = last_;
+  }
+
+  bool pop(std::size_t &task)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(first == last)
+      return false;
+
+    task = first++;
+    return true;
+  }
+
+  bool steal(std::size_t &first_, std::size_t &last_)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(first == last)
+      return false;
+
+    // leave the owner the front half, rounded down
+    first_ = first + (last - first) / 2;
+    last_  = last;
+    last   = first_;
+    return true;
+  }
+};
+
+
+template<typename Size, typename Function>
+void invoke(void *f, std::size_t task)
+{
+  (*static_cast<Function*>(f))(static_cast<Size>(task));
+}
+
+
+} // end thread_pool_detail
+
+
+// A fixed set of std::threads which, together with the calling thread, run the
+// tasks of one job at a time. Each thread starts on an equal share of the
+// tasks and steals from the others once its share runs out.
+class thread_pool
+{
+public:
+  // the pool is started on first use and joined at exit
+  static thread_pool &instance()
+  {
+    static thread_pool pool;
+    return pool;
+  }
+
+  // the number of threads which work on a job, including the calling thread
+  std::size_t size() const
+  {
+    return workers.size() + 1;
+  }
+
+  // Runs f(task) for every task in [0, num_tasks) and returns once all of them
+  // are done. If any of them throws, the tasks which haven't started yet are
+  // skipped and the first exception is rethrown here.
+  template<typename Size, typename Function>
+  void parallel_for(Size num_tasks, Function f)
+  {
+    if(num_tasks <= Size(0))
+      return;
+
+    // there is nothing to share, or the pool is busy with the job which this
+    // call is a task of
+    if(num_tasks == Size(1) || workers.empty() || in_job())
+    {
+      run_inline(num_tasks, f);
+      return;
+    }
+
+    std::unique_lock<std::mutex> job_lock(job_mutex, std::try_to_lock);
+
+    // another thread's job is running on the pool
+    if(!job_lock.owns_lock())
+    {
+      run_inline(num_tasks, f);
+      return;
+    }
+
+    job_function = &thread_pool_detail::invoke<Size,Function>;
+    job_argument = &f;
+
+    // deal the tasks out evenly
+    const std::size_t n = static_cast<std::size_t>(num_tasks);
+    const std::size_t p = size();
+
+    for(std::size_t i = 0; i < p; ++i)
+    {
+      deques[i].assign(n * i / p, n * (i + 1) / p);
+    }
+
+    failed = false;
+
+    {
+      std::lock_guard<std::mutex> lock(state_mutex);
+      active_workers = workers.size();
+      ++generation;
+    }
+
+    wake_up.notify_all();
+
+    in_job() = true;
+    work(0);
+    in_job() = false;
+
+    std::exception_ptr exception;
+
+    {
+      std::unique_lock<std::mutex> lock(state_mutex);
+      job_done.wait(lock, [this]{ return active_workers == 0; });
+
+      exception = error;
+      error     = std::exception_ptr();
+    }
+
+    if(exception)
+    {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  ~thread_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(state_mutex);
+      stopping = true;
+    }
+
+    wake_up.notify_all();
+
+    for(std::size_t i = 0; i < workers.size(); ++i)
+    {
+      workers[i].join();
+    }
+  }
+
+private:
+  std::vector<std::thread> workers;
+
+  // deques[0] belongs to the calling thread and deques[i + 1] to workers[i]
+  std::unique_ptr<thread_pool_detail::task_deque[]> deques;
+
+  // held by the thread whose job is running
+  std::mutex job_mutex;
+
+  void (*job_function)(void *, std::size_t);
+  void *job_argument;
+
+  // set once a task of the current job has thrown
+  std::atomic<bool> failed;
+
+  // guards everything below
+  std::mutex state_mutex;
+  std::condition_variable wake_up;
+  std::condition_variable job_done;
+  std::size_t generation;
+  std::size_t active_workers;
+  bool stopping;
+  std::exception_ptr error;
+
+  thread_pool()
+    : job_function(0),
+      job_argument(0),
+      failed(false),
+      generation(0),
+      active_workers(0),
+      stopping(false)
+  {
+    const std::size_t p = thrust::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    deques.reset(new thread_pool_detail::task_deque[p]);
+
+    workers.reserve(p - 1);
+    for(std::size_t i = 1; i < p; ++i)
+    {
+      workers.push_back(std::thread(&thread_pool::worker_loop, this, i));
+    }
+  }
+
+  thread_pool(const thread_pool &);
+  thread_pool &operator=(const thread_pool &);
+
+  // whether the calling thread is running a task of a job
+  static bool &in_job()
+  {
+    static thread_local bool result = false;
+    return result;
+  }
+
+  template<typename Size, typename Function>
+  static void run_inline(Size num_tasks, Function &f)
+  {
+    for(Size task = 0; task < num_tasks; ++task)
+    {
+      f(task);
+    }
+  }
+
+  void worker_loop(std::size_t me)
+  {
+    in_job() = true;
+
+    std::size_t seen = 0;
+
+    for(;;)
+    {
+      {
+        std::unique_lock<std::mutex> lock(state_mutex);
+        wake_up.wait(lock, [&]{ return stopping || generation != seen; });
+
+        if(stopping)
+          return;
+
+        seen = generation;
+      }
+
+      work(me);
+
+      {
+        std::lock_guard<std::mutex> lock(state_mutex);
+
+        if(--active_workers == 0)
+        {
+          job_done.notify_one();
+        }
+      }
+    }
+  }
+
+  // runs tasks of the current job until there are none left to take
+  void work(std::size_t me)
+  {
+    const std::size_t p = size();
+
+    for(;;)
+    {
+      std::size_t task;
+
+      if(deques[me].pop(task))
+      {
+        execute(task);
+        continue;
+      }
+
+      // look for a victim, starting with the next thread along
+      bool stole = false;
+
+      for(std::size_t i = 1; i < p && !stole; ++i)
+      {
+        std::size_t first, last;
+
+        if(deques[(me + i) % p].steal(first, last))
+        {
+          deques[me].assign(first, last);
+          stole = true;
+        }
+      }
+
+      if(!stole)
+        return;
+    }
+  }
+
+  void execute(std::size_t task)
+  {
+    if(failed)
+      return;
+
+    try
+    {
+      job_function(job_argument, task);
+    }
+    catch(...)
+    {
+      std::lock_guard<std::mutex> lock(state_mutex);
+
+      if(!error)
+      {
+        error = std::current_exception();
+      }
+
+      failed = true;
+    }
+  }
+};
+
+
+} // end detail
+} // end threads
+} // end system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,174 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+/*! \file thrust/system/threads/execution_policy.h
+ *  \brief Execution policies for Thrust's std::thread system.
+ */
+
+// get the execution policies definitions first
+#include <thrust/system/threads/detail/execution_policy.h>
+
+// get the definition of par
+#include <thrust/system/threads/detail/par.h>
+
+// now get all the algorithm definitions
+
+#include <thrust/system/threads/detail/adjacent_difference.h>
+#include <thrust/system/threads/detail/assign_value.h>
+#include <thrust/system/threads/detail/binary_search.h>
+#include <thrust/system/threads/detail/copy.h>
+#include <thrust/system/threads/detail/copy_if.h>
+#include <thrust/system/threads/detail/count.h>
+#include <thrust/system/threads/detail/equal.h>
+#include <thrust/system/threads/detail/extrema.h>
+#include <thrust/system/threads/detail/fill.h>
+#include <thrust/system/threads/detail/find.h>
+#include <thrust/system/threads/detail/for_each.h>
+#include <thrust/system/threads/detail/gather.h>
+#include <thrust/system/threads/detail/generate.h>
+#include <thrust/system/threads/detail/get_value.h>
+#include <thrust/system/threads/detail/inner_product.h>
+#include <thrust/system/threads/detail/iter_swap.h>
+#include <thrust/system/threads/detail/logical.h>
+#include <thrust/system/threads/detail/malloc_and_free.h>
+#include <thrust/system/threads/detail/merge.h>
+#include <thrust/system/threads/detail/mismatch.h>
+#include <thrust/system/threads/detail/partition.h>
+#include <thrust/system/threads/detail/reduce.h>
+#include <thrust/system/threads/detail/reduce_by_key.h>
+#include <thrust/system/threads/detail/remove.h>
+#include <thrust/system/threads/detail/replace.h>
+#include <thrust/system/threads/detail/reverse.h>
+#include <thrust/system/threads/detail/scan.h>
+#include <thrust/system/threads/detail/scan_by_key.h>
+#include <thrust/system/threads/detail/scatter.h>
+#include <thrust/system/threads/detail/sequence.h>
+#include <thrust/system/threads/detail/set_operations.h>
+#include <thrust/system/threads/detail/sort.h>
+#include <thrust/system/threads/detail/swap_ranges.h>
+#include <thrust/system/threads/detail/tabulate.h>
+#include <thrust/system/threads/detail/transform.h>
+#include <thrust/system/threads/detail/transform_reduce.h>
+#include <thrust/system/threads/detail/transform_scan.h>
+#include <thrust/system/threads/detail/uninitialized_copy.h>
+#include <thrust/system/threads/detail/uninitialized_fill.h>
+#include <thrust/system/threads/detail/unique.h>
+#include <thrust/system/threads/detail/unique_by_key.h>
+
+
+// define these entities here for the purpose of Doxygenating them
+// they are actually defined elsewhere
+#if 0
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace threads
+{
+
+
+/*! \addtogroup execution_policies
+ *  \{
+ */
+
+
+/*! \p thrust::threads::execution_policy is the base class for all Thrust parallel execution
+ *  policies which are derived from Thrust's std::thread backend system.
+ */
+template<typename DerivedPolicy>
+struct execution_policy : thrust::execution_policy<DerivedPolicy>
+{};
+
+
+/*! \p threads::tag is a type representing Thrust's std::thread backend system in C++'s type system.
+ *  Iterators "tagged" with a type which is convertible to \p threads::tag assert that they may be
+ *  "dispatched" to algorithm implementations in the \p threads system.
+ */
+struct tag : thrust::system::threads::execution_policy<tag> { unspecified };
+
+
+/*! \p thrust::threads::par is the parallel execution policy associated with Thrust's std::thread
+ *  backend system.
+ *
+ *  Instead of relying on implicit algorithm dispatch through iterator system tags, users may
+ *  directly target Thrust's std::thread backend system by providing \p thrust::threads::par as an algorithm
+ *  parameter.
+ *
+ *  Explicit dispatch can be useful in avoiding the introduction of data copies into containers such
+ *  as \p thrust::threads::vector.
+ *
+ *  The type of \p thrust::threads::par is implementation-defined.
+ *
+ *  The following code snippet demonstrates how to use \p thrust::threads::par to explicitly dispatch an
+ *  invocation of \p thrust::for_each to the std::thread backend system:
+ *
+ *  \code
+ *  #include <thrust/for_each.h>
+ *  #include <thrust/system/threads/execution_policy.h>
+ *  #include <cstdio>
+ *
+ *  struct printf_functor
+ *  {
+ *    __host__ __device__
+ *    void operator()(int x)
+ *    {
+ *      printf("%d\n", x);
+ *    }
+ *  };
+ *  ...
+ *  int vec[3];
+ *  vec[0] = 0; vec[1] = 1; vec[2] = 2;
+ *
+ *  thrust::for_each(thrust::threads::par, vec.begin(), vec.end(), printf_functor());
+ *
+ *  // 0 1 2 is printed to standard output in some unspecified order
+ *  \endcode
+ *
+ *  The algorithms of this system run on a pool of <tt>std::thread</tt>s which is created the first
+ *  time it is needed and lives until the program exits. It has one thread fewer than
+ *  <tt>std::thread::hardware_concurrency()</tt>, because the calling thread takes part in the work.
+ *  Each thread works through its own share of an algorithm's tiles and steals from the others
+ *  once its share runs out. An algorithm invoked from inside another one, e.g. from the functor
+ *  passed to \p thrust::for_each, runs sequentially on the calling thread.
+ *
+ *  An algorithm given fewer elements than it is worth splitting into tiles for runs sequentially
+ *  on the calling thread too. The cutoff depends on the algorithm and the type of its elements;
+ *  <tt>par.min_parallel_size(n)</tt> returns a policy whose algorithms use the cutoff \p n instead.
+ */
+static const unspecified par;
+
+
+/*! \}
+ */
+
+
+} // end threads
+} // end system
+THRUST_NAMESPACE_END
+#endif
+
+